@@ -120,6 +120,31 @@ regex_filter(T& elem, L& lchildren)
     elem.children.insert(elem.children.begin(), f_begin, f_end);
 }
 
+//##############################################################################
+// The part of an anchored regex that every match must start with; empty if
+// there isn't one we can be sure of.
+//##############################################################################
+std::string
+regex_literal_prefix(const std::string &re_word)
+{
+    BOOST_LOG_FUNCTION();
+    std::string literal;
+    if (re_word.empty() || re_word[0] != '^' || re_word.find('|') != std::string::npos) {
+        return literal;
+    }
+    static const std::string special { "\\.[](){}*+?|^$" };
+    for (auto it = re_word.begin() + 1; it != re_word.end(); ++it) {
+        if (*it == '\0' || special.find(*it) != std::string::npos) {
+            if ((*it == '*' || *it == '?' || *it == '{') && !literal.empty()) {
+                literal.pop_back();                                             // the quantifier makes the last one optional
+            }
+            break;
+        }
+        literal.push_back(*it);
+    }
+    return literal;
+}
+
 //##############################################################################
 //##############################################################################
 void
@@ -156,7 +181,20 @@ void
 RangeExpandingVisitor::operator()(ast::ASTIntersection& inter) const
 {
     BOOST_LOG_FUNCTION();
-    boost::apply_visitor(RangeExpandingVisitor(graph_, env_name_, prefix_), inter.lhs);
+    std::string pushdown;
+    if (typeid(ast::ASTRegex) == inter.rhs.type() && typeid(ast::ASTFunction) == inter.lhs.type()
+            && boost::get<ast::ASTRegex>(inter.rhs).positive) {
+        pushdown = regex_literal_prefix(boost::get<ast::ASTRegex>(inter.rhs).word);
+    }
+
+    if (!pushdown.empty()) {                                                    // let the function narrow its scan
+        LOG(debug4, "pushdown_name_prefix") << pushdown;
+        auto &fn = boost::get<ast::ASTFunction>(inter.lhs);
+        (*this)(fn.args_node);
+        fn.children = fn.fn->with_name_prefix(env_name_, fn.args_node.argument_vecs, pushdown);
+    } else {
+        boost::apply_visitor(RangeExpandingVisitor(graph_, env_name_, prefix_), inter.lhs);
+    }
     auto lchildren = boost::apply_visitor(FetchChildrenVisitor(), inter.lhs);
     std::sort(lchildren.begin(), lchildren.end());
 
@@ -270,15 +308,12 @@ RangeExpandingVisitor::operator()(ast::ASTExpand& expand) const
             prefix_child(child);
             auto n = graph_->get_node(child);
             if(!n) { THROW_STACK(InvalidRangeExpression("cannot resolve node" + child)); }
-            auto edges = n->forward_edges();
+            auto edges = n->forward_edge_range();
 
-            std::vector<std::string> edge_names; 
-            for (auto edge : edges) {
-                edge_names.push_back(edge->name());
+            expand.children.reserve(expand.children.size() + edges.size());
+            for (auto &edge : edges) {
+                expand.children.push_back(edge.name.to_string());
             }
-
-            expand.children.reserve(edges.size());
-            expand.children.insert(expand.children.end(), edge_names.begin(), edge_names.end());
         }
     }
 
@@ -300,15 +335,12 @@ RangeExpandingVisitor::operator()(ast::ASTGetCluster& getcl) const
         prefix_child(child);
         auto n = graph_->get_node(child);
         if(!n) { THROW_STACK(InvalidRangeExpression("cannot resolve node" + child)); }
-        auto edges = n->reverse_edges();
+        auto edges = n->reverse_edge_range();
 
-        std::vector<std::string> edge_names; 
-        for (auto edge : edges) {
-            edge_names.push_back(edge->name());
+        getcl.children.reserve(getcl.children.size() + edges.size());
+        for (auto &edge : edges) {
+            getcl.children.push_back(edge.name.to_string());
         }
-
-        getcl.children.reserve(edges.size());
-        getcl.children.insert(getcl.children.end(), edge_names.begin(), edge_names.end());
     }
 }
 
@@ -72,6 +72,12 @@ class RangeExpandingVisitor : public boost::static_visitor<>
         
 };
 
+//##############################################################################
+/// @param re_word regex, as written between the slashes
+/// @return the literal text every match of an anchored (^...) regex starts
+///         with, or empty if there is none
+std::string regex_literal_prefix(const std::string &re_word);
+
 static EmitterModuleRegistration FetchChildrenVisitorModule { "compiler.FetchChildrenVisitor" };
 //##############################################################################
 //##############################################################################
@@ -34,6 +34,8 @@
 #include "../graph/graph_exceptions.h"
 #include "../db/db_interface.h"
 #include "../graph/graph_interface.h"
+#include "../graph/csr_snapshot.h"
+#include "../graph/host_closure.h"
 #include <boost/exception_ptr.hpp>
 
 #include "config.h"
@@ -55,6 +57,13 @@ class RangeAPI_v1
             UNKNOWN
         };
 
+        //######################################################################
+        /// One write API call, by write_api_symtable name, for apply_batch
+        struct Mutation {
+            std::string method;
+            std::vector<std::string> args;
+        };
+
         static const std::map<std::string, std::function<bool(RangeAPI_v1*, std::vector<std::string>, uint64_t)>> write_api_symtable;
 
         typedef ::range::graph::NodeIface::node_type node_type;
@@ -91,6 +100,15 @@ class RangeAPI_v1
         void shutdown() {
             cfg_->db_backend()->shutdown();
         }
+
+        //######################################################################
+        /// Bring the in-memory snapshot of the primary graph up to date, if
+        /// Config::csr_snapshot() is set, re-reading only the nodes written
+        /// since (see BackendInterface::subscribe_deltas()). Head reads are
+        /// served from the last one this published and never build one
+        /// themselves, so the writer calls it after each write (stored's
+        /// learner does).
+        void refresh_head_snapshot() const;
         
         //######################################################################
         //######################################################################
@@ -136,6 +154,28 @@ class RangeAPI_v1
         /// @return vector of hostnames
         virtual RangeStruct all_hosts(uint64_t version=-1) const;
 
+        //######################################################################
+        /// Get a list of all nodes whose names start with prefix, e.g.
+        /// "prod#" for the clusters named in environment prod
+        ///
+        /// @param[in] prefix leading part of the names wanted
+        /// @param[in] version version of primary graph to query
+        /// @return vector of node names, in name order
+        virtual RangeStruct find_nodes_by_prefix(const std::string &prefix,
+                                                 uint64_t version=-1) const;
+
+        //######################################################################
+        /// Get a list of all nodes with value among their values for tag
+        /// key, e.g. the clusters tagged ROLE=kafka
+        ///
+        /// @param[in] key tag key
+        /// @param[in] value tag value wanted
+        /// @param[in] version version of primary graph to query
+        /// @return vector of node names, in name order
+        virtual RangeStruct find_nodes_by_tag(const std::string &key,
+                                              const std::string &value,
+                                              uint64_t version=-1) const;
+
         //######################################################################
         /// Expand a range expression
         ///
@@ -267,6 +307,19 @@ class RangeAPI_v1
                 uint64_t version=-1, 
                 size_t depth=std::numeric_limits<size_t>::max()) const;
 
+        //######################################################################
+        /// Hosts under node_name: the ones expand() would list, without
+        /// building the tree (each host once, sorted)
+        ///
+        /// @param[in] env_name Name of environment
+        /// @param[in] node_name name of node to expand from
+        /// @param[in] version version of primary graph to query
+        /// @return vector of host names
+        virtual RangeStruct expand_hosts(
+                const std::string &env_name,
+                const std::string &node_name,
+                uint64_t version=-1) const;
+
 
         //######################################################################
         /// Get list of parent nodes for node_name
@@ -626,11 +679,35 @@ class RangeAPI_v1
                                                 const std::string &dependency_name,
                                                 uint64_t id=0);
 
+        //######################################################################
+        /// Apply several write API calls as one change: one range transaction,
+        /// one new version of each graph, and nothing applied if any of them
+        /// fails. Later mutations see the effects of earlier ones.
+        ///
+        /// @param[in] mutations calls to make, in order; any write_api_symtable
+        ///            method except apply_batch itself
+        /// @param[in] id id number of the request 
+        /// @return true on success, false on failure
+        virtual bool apply_batch(const std::vector<Mutation> &mutations, uint64_t id=0);
+
+        //######################################################################
+        /// Flatten mutations into request args: method, argument count, then
+        /// the arguments, for each mutation in turn.
+        static std::vector<std::string> encode_batch(const std::vector<Mutation> &mutations);
+
+        //######################################################################
+        /// Inverse of encode_batch; throws IncorrectNumberOfArguments if args
+        /// is not a well-formed batch of known methods.
+        static std::vector<Mutation> decode_batch(const std::vector<std::string> &args);
 
         static const std::map<std::string, size_t> num_arguments;
     private:
         range::Emitter log;
         boost::shared_ptr<Config> cfg_;
+        std::map<std::string, boost::shared_ptr<graph::GraphInterface>> batch_graphs_;   // current graphs while in apply_batch
+
+        db::BackendInterface::txn_type_p start_range_txn(db::RangeTxn::req_type_p req);
+        boost::shared_ptr<graph::GraphTxnIface> start_graph_txn(boost::shared_ptr<graph::GraphInterface> graph);
 
         boost::shared_ptr<graph::GraphInterface> graphdb(const std::string &name, uint64_t version) const;
         std::string env_prefix(const std::string &env_name) const;
@@ -639,6 +716,13 @@ class RangeAPI_v1
         graph::NodeIface::node_t get_node(boost::shared_ptr<graph::GraphInterface> graph,
                                           const std::string &env_name,
                                           const std::string &node_name) const;
+        boost::shared_ptr<const graph::CsrSnapshot> head_snapshot(const std::string &name,
+                                                                  uint64_t version) const;
+        boost::shared_ptr<const graph::CsrSnapshot> update_head_snapshot() const;
+        boost::shared_ptr<graph::HostClosure> host_closure() const;
+        graph::CsrSnapshot::index_t get_node(const graph::CsrSnapshot &snap,
+                                             const std::string &env_name,
+                                             const std::string &node_name) const;
 };
 
 } // namespace range
@@ -17,6 +17,8 @@
 
 #include "builtins.h"
 
+#include <algorithm>
+
 #include <boost/variant/get.hpp>
 
 #include "json_visitor.h"
@@ -66,55 +68,6 @@ size_t ExpandFn::n_args() const { return 1; }
 //##############################################################################
 //##############################################################################
 
-static ::range::EmitterModuleRegistration ExpandHostsVisitorLogModule { "builtins.ExpandHostsVisitor" };
-//##############################################################################
-class ExpandHostsVisitor : public boost::static_visitor<void>
-{
-    public:
-        mutable std::vector<std::string> hosts;
-
-        explicit ExpandHostsVisitor(const std::string &env_name) 
-            : log(ExpandHostsVisitorLogModule), env_name_(env_name) 
-        { }
-
-        void operator()(const range::RangeObject &obj) const
-        {
-            BOOST_LOG_FUNCTION();
-
-            if(obj.values.empty()) { return; }
-
-            if(log.loglevel() > Emitter::logseverity::debug8) {
-                RangeStruct top = obj;
-                LOG(debug9,"expand_hosts_visitor.object") << boost::apply_visitor(::range::JSONVisitor(), top);
-            }
-
-            const std::string &type = boost::get<range::RangeString>(obj.values.find("type")->second).value;
-            const std::string &name = boost::get<range::RangeString>(obj.values.find("name")->second).value;
-            const range::RangeObject &children = boost::get<range::RangeObject>(obj.values.find("children")->second);
-
-
-            if (type == "HOST") {
-                hosts.push_back(std::string(name));
-            } else {
-                for (auto child : children.values) {
-                    boost::apply_visitor(*this, child.second);
-                }
-            }
-        }
-
-        void operator()(const RangeArray &) const { return; }
-        void operator()(const RangeTuple &) const { return; }
-        void operator()(const RangeNumber &) const { return; }
-        void operator()(const RangeString &) const { return; }
-        void operator()(const RangeTrue &) const { return; }
-        void operator()(const RangeFalse &) const { return; }
-        void operator()(const RangeNull &) const { return; }
-    private:
-        range::Emitter log;
-        std::string env_name_;
-};
-
-
 //##############################################################################
 std::vector<std::string>
 ExpandHostsFn::operator()(
@@ -132,16 +85,18 @@ ExpandHostsFn::operator()(
     for(std::string elem : args[0]) {
         RangeStruct top;
         try {
-            top = api.expand(env_name_, elem);
+            top = api.expand_hosts(env_name_, elem);
         }
         catch(range::Exception &e) {
             LOG(error, "expand_hosts.expand_error") << e.what();
             continue;
         }
-        ExpandHostsVisitor visitor { env_name_ };
-        boost::apply_visitor(visitor, top);
-        ret.reserve(ret.size() + visitor.hosts.size());
-        ret.insert(ret.end(), visitor.hosts.begin(), visitor.hosts.end());
+
+        auto &hosts = boost::get<range::RangeArray>(top).values;
+        ret.reserve(ret.size() + hosts.size());
+        for(auto &e : hosts) {
+            ret.push_back(boost::get<range::RangeString>(e).value);
+        }
     }
     return ret;
 }
@@ -259,4 +214,122 @@ AllClustersFn::operator()(
 //##############################################################################
 size_t AllClustersFn::n_args() const { return 0; }
 
+//##############################################################################
+//##############################################################################
+// NodesFn
+//##############################################################################
+//##############################################################################
+
+//##############################################################################
+std::vector<std::string>
+NodesFn::operator()(
+        const std::string &env_name_,
+        const std::vector<std::vector<std::string>> &args)
+{
+    BOOST_LOG_FUNCTION();
+    return this->with_name_prefix(env_name_, args, "");
+}
+
+//##############################################################################
+// Each argument is scanned for separately; when the compiler has a prefix
+// too, only the longer of the two needs scanning (if they overlap at all).
+//##############################################################################
+std::vector<std::string>
+NodesFn::with_name_prefix(
+        const std::string &,
+        const std::vector<std::vector<std::string>> &args,
+        const std::string &name_prefix)
+{
+    BOOST_LOG_FUNCTION();
+    std::vector<std::string> ret;
+
+    if(args.size() > n_args()) {
+        return ret;
+    }
+
+    std::vector<std::string> prefixes = args.empty() ? std::vector<std::string>{ "" } : args[0];
+    ::range::RangeAPI_v1 api { range::config };
+    for(const std::string &p : prefixes) {
+        std::string scan;
+        if(p.compare(0, name_prefix.size(), name_prefix) == 0) {
+            scan = p;
+        } else if(name_prefix.compare(0, p.size(), p) == 0) {
+            scan = name_prefix;
+        } else {
+            continue;
+        }
+
+        RangeStruct top;
+        try {
+            top = api.find_nodes_by_prefix(scan);
+        }
+        catch(range::Exception &e) {
+            LOG(error, "nodes.find_nodes_by_prefix_error") << e.what();
+            continue;
+        }
+        for(auto &e : boost::get<range::RangeArray>(top).values) {
+            ret.push_back(boost::get<range::RangeString>(e).value);
+        }
+    }
+
+    std::sort(ret.begin(), ret.end());
+    ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+    return ret;
+}
+
+//##############################################################################
+size_t NodesFn::n_args() const { return 1; }
+
+//##############################################################################
+//##############################################################################
+// HasFn
+//##############################################################################
+//##############################################################################
+
+//##############################################################################
+// Clusters in other environments are left out; nodes that don't belong to an
+// environment (hosts) are not.
+//##############################################################################
+std::vector<std::string>
+HasFn::operator()(
+        const std::string &env_name_,
+        const std::vector<std::vector<std::string>> &args)
+{
+    BOOST_LOG_FUNCTION();
+    std::vector<std::string> ret;
+
+    if(args.size() != n_args()) {
+        return ret;
+    }
+
+    std::string env_prefix = env_name_.empty() ? "" : env_name_ + "#";
+    ::range::RangeAPI_v1 api { range::config };
+    for(const std::string &key : args[0]) {
+        for(const std::string &value : args[1]) {
+            RangeStruct top;
+            try {
+                top = api.find_nodes_by_tag(key, value);
+            }
+            catch(range::Exception &e) {
+                LOG(error, "has.find_nodes_by_tag_error") << e.what();
+                continue;
+            }
+            for(auto &e : boost::get<range::RangeArray>(top).values) {
+                const std::string &name = boost::get<range::RangeString>(e).value;
+                if(env_prefix.empty() || name.compare(0, env_prefix.size(), env_prefix) == 0
+                        || name.find('#') == std::string::npos) {
+                    ret.push_back(name);
+                }
+            }
+        }
+    }
+
+    std::sort(ret.begin(), ret.end());
+    ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+    return ret;
+}
+
+//##############################################################################
+size_t HasFn::n_args() const { return 2; }
+
 } /* builtins */ } /* range */
@@ -79,11 +79,37 @@ struct AllClustersFn : public ::range::RangeFunction
     ::range::Emitter log;
 };
 
-/*
+static ::range::EmitterModuleRegistration NodesFnLogModule { "builtins.NodesFn" };
 //##############################################################################
+/// nodes(prefix): every node whose name starts with prefix (every node, with
+/// no argument); e.g. nodes(prod#), nodes(web{1,2}). A range scan, so it only
+/// reads the matching nodes when the graph is stored in name order.
+//##############################################################################
+struct NodesFn : public ::range::RangeFunction
+{
+    NodesFn() : log(NodesFnLogModule) { }
+    virtual std::vector<std::string> operator()(
+            const std::string &env_name_,
+            const std::vector<std::vector<std::string>> &args) override;
+
+    virtual std::vector<std::string> with_name_prefix(
+            const std::string &env_name_,
+            const std::vector<std::vector<std::string>> &args,
+            const std::string &name_prefix) override;
+
+    virtual size_t n_args() const override;
+    ::range::Emitter log;
+};
+
+static ::range::EmitterModuleRegistration HasFnLogModule { "builtins.HasFn" };
+//##############################################################################
+/// has(KEY;value): the nodes with value among their values for tag KEY; e.g.
+/// has(ROLE;kafka). Looked up in the tag index rather than by reading every
+/// node's tags.
 //##############################################################################
 struct HasFn : public ::range::RangeFunction
 {
+    HasFn() : log(HasFnLogModule) { }
     virtual std::vector<std::string> operator()(
             const std::string &env_name_,
             const std::vector<std::vector<std::string>> &args) override;
@@ -92,6 +118,7 @@ struct HasFn : public ::range::RangeFunction
     ::range::Emitter log;
 };
 
+/*
 //##############################################################################
 //##############################################################################
 struct RoleFn : public ::range::RangeFunction
@@ -56,6 +56,9 @@ struct Config {
         virtual std::string node_id() const
         { return node_id_; }
 
+        virtual bool csr_snapshot() const
+        { return csr_snapshot_; }
+
         virtual void db_backend(boost::shared_ptr<db::BackendInterface> v)
         { db_backend_ = v; }
 
@@ -85,6 +88,9 @@ struct Config {
             node_id_ = v;
         }
 
+        virtual void csr_snapshot(bool v)
+        { csr_snapshot_ = v; }
+
 
         Config(
                 boost::shared_ptr<db::BackendInterface> db_backend,
@@ -117,6 +123,7 @@ struct Config {
         uint32_t stored_request_timeout_;
         uint32_t reader_ack_timeout_;
         std::string node_id_;
+        bool csr_snapshot_ = false;                                             // serve head reads from graph::CsrSnapshot
 
 
 };
@@ -16,15 +16,19 @@
  */
 #include "builtins.h"
 
+#include <fstream>
 #include <map>
 
 #include <boost/asio/ip/host_name.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/ini_parser.hpp>
 
 #include "config_builder.h"
+#include "exceptions.h"
 #include "stored_config.h"
 #include "../db/berkeley_dbcxx_backend.h"
 #include "../db/config_interface.h"
-#include "../db/pbuff_node.h"
+#include "../db/head_node.h"
 #include "../graph/node_factory.h"
 #include "../graph/graphdb.h"
 #include "../compiler/compiler_types.h"
@@ -44,14 +48,92 @@ build_symtable() {
     (*symtable)["expand_hosts"] = boost::make_shared<range::builtins::ExpandHostsFn>();
     (*symtable)["clusters"] = boost::make_shared<range::builtins::ClustersFn>();
     (*symtable)["all_clusters"] = boost::make_shared<range::builtins::AllClustersFn>();
+    (*symtable)["nodes"] = boost::make_shared<range::builtins::NodesFn>();
+    (*symtable)["has"] = boost::make_shared<range::builtins::HasFn>();
 
     return symtable;
 }
 
+//##############################################################################
+// Missing file: no settings
+//##############################################################################
+static boost::property_tree::ptree
+read_config_file(const std::string& filename)
+{
+    boost::property_tree::ptree file;
+    std::ifstream in { filename };
+    if (in) {
+        try {
+            boost::property_tree::ini_parser::read_ini(in, file);
+        } catch (boost::property_tree::ini_parser_error &e) {
+            throw InvalidConfigException(filename + ": " + e.what());
+        }
+    }
+    return file;
+}
+
+//##############################################################################
+// The [db] section of the config file, e.g.
+//
+//   [db]
+//   home = /var/lib/rangexx
+//   cache_size = 67108864
+//   node_cache_size = 65536
+//   write_durability = group_commit       ; sync, write_nosync or group_commit
+//   group_commit_delay = 500              ; microseconds
+//   graph_access_method = btree           ; hash or btree, for new graphs
+//
+// Missing settings, or a missing file, keep the defaults
+//##############################################################################
+static boost::shared_ptr<db::ConfigIface>
+build_db_config(const boost::property_tree::ptree& file)
+{
+    db::ConfigIface defaults;
+    std::map<std::string, db::ConfigIface::durability> durabilities {
+        { "sync", db::ConfigIface::durability::SYNC },
+        { "write_nosync", db::ConfigIface::durability::WRITE_NOSYNC },
+        { "group_commit", db::ConfigIface::durability::GROUP_COMMIT },
+    };
+
+    auto durability = defaults.write_durability();
+    if (auto v = file.get_optional<std::string>("db.write_durability")) {
+        auto it = durabilities.find(*v);
+        if (it == durabilities.end()) {
+            throw InvalidConfigException("db.write_durability: unknown value " + *v);
+        }
+        durability = it->second;
+    }
+
+    auto access_method = defaults.graph_access_method();
+    if (auto v = file.get_optional<std::string>("db.graph_access_method")) {
+        if (*v == "hash") {
+            access_method = db::ConfigIface::access_method::HASH;
+        } else if (*v == "btree") {
+            access_method = db::ConfigIface::access_method::BTREE;
+        } else {
+            throw InvalidConfigException("db.graph_access_method: unknown value " + *v);
+        }
+    }
+
+    try {
+        return boost::make_shared<db::ConfigIface>(
+                file.get("db.home", defaults.db_home()),
+                file.get("db.cache_size", defaults.cache_size()),
+                file.get("db.node_cache_size", defaults.node_cache_size()),
+                durability,
+                std::chrono::microseconds(file.get("db.group_commit_delay",
+                        defaults.group_commit_delay().count())),
+                access_method);
+    } catch (boost::property_tree::ptree_bad_data &e) {
+        throw InvalidConfigException(e.what());
+    }
+}
+
+//##############################################################################
+//##############################################################################
 boost::shared_ptr<Config>
 config_builder(const std::string& filename, Consumer type)
 {
-    (void)(filename);
 
     Config * cfg; 
     switch (type) {
@@ -64,13 +146,14 @@ config_builder(const std::string& filename, Consumer type)
     }
 
     
-    auto db_conf = boost::make_shared<db::ConfigIface>("/var/lib/rangexx", 67108864);
+    auto file = read_config_file(filename);
+    auto db_conf = build_db_config(file);
     auto db = range::db::BerkeleyDB::get( db_conf );
 
     cfg->db_backend(db);
     cfg->db_backend()->register_thread();
     cfg->graph_factory(boost::make_shared<graph::GraphdbConcreteFactory<graph::GraphDB>>());
-    cfg->node_factory(boost::make_shared<graph::NodeIfaceConcreteFactory<db::ProtobufNode>>()); 
+    cfg->node_factory(boost::make_shared<graph::NodeIfaceConcreteFactory<db::HeadNode>>());
     cfg->range_symbol_table(build_symtable());
     cfg->stored_mq_name("rangexx_request");
     std::string fqdn;
@@ -117,6 +200,11 @@ config_builder(const std::string& filename, Consumer type)
             dynamic_cast<StoreDaemonConfig*>(cfg)->heartbeat_timeout(1000);
             dynamic_cast<StoreDaemonConfig*>(cfg)->port(5444);
             dynamic_cast<StoreDaemonConfig*>(cfg)->range_cell_name("testcell");
+            try {                                                               // [stored] csr_snapshot; only stored's learner publishes one
+                cfg->csr_snapshot(file.get("stored.csr_snapshot", cfg->csr_snapshot()));
+            } catch (boost::property_tree::ptree_bad_data &e) {
+                throw InvalidConfigException(std::string("stored.csr_snapshot: ") + e.what());
+            }
             break;
     }
 
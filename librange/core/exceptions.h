@@ -85,6 +85,15 @@ struct InvalidEnvironmentException : public Exception {
         { }
 };
 
+//##############################################################################
+//##############################################################################
+struct InvalidConfigException : public Exception {
+    InvalidConfigException(const std::string &what, 
+            const std::string &event="InvalidConfigException")
+        : Exception(what, event)
+        { }
+};
+
 
 namespace stored {
 
@@ -30,6 +30,24 @@ class RangeFunction {
         virtual std::vector<std::string> operator()(const std::string &env_name,
                 const std::vector<std::vector<std::string>>& args) = 0;
         virtual size_t n_args() const = 0;
+
+        //######################################################################
+        /// As operator(), when only results starting with name_prefix are
+        /// wanted; the compiler passes the literal prefix of an anchored
+        /// regex that the results are intersected with. Functions that scan
+        /// the graph can narrow their scan with it.
+        virtual std::vector<std::string> with_name_prefix(const std::string &env_name,
+                const std::vector<std::vector<std::string>>& args,
+                const std::string &name_prefix)
+        {
+            std::vector<std::string> found;
+            for (auto &r : (*this)(env_name, args)) {
+                if (r.compare(0, name_prefix.size(), name_prefix) == 0) {
+                    found.push_back(r);
+                }
+            }
+            return found;
+        }
     protected:
         RangeFunction() = default;
 };
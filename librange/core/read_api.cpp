@@ -31,6 +31,8 @@
 #include <unordered_map>
 #include <map>
 #include <thread>
+#include <mutex>
+#include <set>
 
 #include <boost/variant/apply_visitor.hpp>
 
@@ -40,6 +42,7 @@
 
 #include "../compiler/expanding_visitor.h"
 #include "../compiler/RangeParser_v1.h"
+#include "../graph/id_adjacency.h"
 extern "C" {
 #include "../gnu/parse-datetime.h"
 }
@@ -52,6 +55,12 @@ inline boost::shared_ptr<graph::GraphInterface>
 RangeAPI_v1::graphdb(const std::string &name, uint64_t version) const
 {
     BOOST_LOG_FUNCTION();
+    if (version == static_cast<uint64_t>(-1)) {
+        auto it = batch_graphs_.find(name);                                     // inside apply_batch; share its transactions
+        if (it != batch_graphs_.end()) {
+            return it->second;
+        }
+    }
     auto graphdb = cfg_->graph_factory()->createGraphdb(name,
                     cfg_->db_backend(), cfg_->node_factory(), version);
     if (version != static_cast<uint64_t>(-1)) {
@@ -178,32 +187,184 @@ RangeAPI_v1::get_node(boost::shared_ptr<graph::GraphInterface> graph,
     return n;
 }
 
+//##############################################################################
+/// What the primary graph's CsrSnapshot needs to be brought up to date
+//##############################################################################
+struct csr_feed_t {
+    std::mutex build_lock;                                                      // one builder at a time
+    std::mutex changed_lock;
+    db::BackendInterface::subscription_t subscription;
+    std::set<std::string> changed;                                              // nodes written since the published snapshot
+    uint64_t through = 0;                                                       // changed covers versions up to this
+};
+
+static csr_feed_t&
+csr_feed(db::BackendInterface &backend)
+{
+    return *backend.graph_state<csr_feed_t>("primary", []() {
+                return boost::make_shared<csr_feed_t>();
+            });
+}
+
+//##############################################################################
+/// Patch the published snapshot with the nodes written since it was built,
+/// or build one from scratch if there is none or its deltas can't be had.
+/// MUST HOLD csr_feed(backend).build_lock and a read snapshot.
+//##############################################################################
+boost::shared_ptr<const graph::CsrSnapshot>
+RangeAPI_v1::update_head_snapshot() const
+{
+    BOOST_LOG_FUNCTION();
+    auto backend = cfg_->db_backend();
+    auto &feed = csr_feed(*backend);
+    const auto primary = graphdb("primary", -1);
+    uint64_t head = primary->version();
+
+    auto snap = graph::CsrSnapshot::current(*backend, "primary");
+    if (snap && snap->version() == head) {
+        return snap;
+    }
+    if (snap && feed.subscription && backend->catch_up_deltas("primary")) {
+        std::set<std::string> changed;
+        uint64_t through;
+        {
+            std::lock_guard<std::mutex> guard { feed.changed_lock };
+            changed.swap(feed.changed);
+            through = feed.through;
+        }
+        if (through == head) {
+            snap = snap->patch(*primary, changed);
+            graph::CsrSnapshot::publish(*backend, "primary", snap);
+            LOG(debug2, "csr_snapshot_patched") << snap->version() << ':' << changed.size();
+            return snap;
+        }
+    }
+
+    snap = graph::CsrSnapshot::build(*primary, graph::NameInterner::get(*backend, "primary"));
+    {
+        std::lock_guard<std::mutex> guard { feed.changed_lock };
+        feed.changed.clear();
+        feed.through = snap->version();
+    }
+    feed.subscription = backend->subscribe_deltas("primary", snap->version(),
+            [&feed](const db::BackendInterface::graph_delta_t &delta) {
+                std::lock_guard<std::mutex> guard { feed.changed_lock };
+                feed.changed.insert(delta.nodes.begin(), delta.nodes.end());
+                feed.through = delta.version;
+            });
+    graph::CsrSnapshot::publish(*backend, "primary", snap);
+    LOG(debug2, "csr_snapshot_built") << snap->version() << ':' << snap->size();
+    return snap;
+}
+
+//##############################################################################
+//##############################################################################
+void
+RangeAPI_v1::refresh_head_snapshot() const
+{
+    RANGE_LOG_TIMED_FUNCTION();
+    if (!cfg_->csr_snapshot()) {
+        return;
+    }
+    try {
+        auto snapshot = cfg_->db_backend()->read_snapshot();
+        std::lock_guard<std::mutex> guard { csr_feed(*cfg_->db_backend()).build_lock };
+        update_head_snapshot();
+    }
+    catch (range::Exception &e) {
+        LOGBACKTRACE(e);
+        LOG(error, "csr_snapshot_refresh_failed") << e.what();
+        graph::CsrSnapshot::publish(*cfg_->db_backend(), "primary", nullptr);   // readers go back to the graph until the next refresh
+    }
+}
+
+//##############################################################################
+/// @return snapshot of graph name to serve a read at version from, or
+///         nullptr to read the graph itself: when snapshots are off, for
+///         older versions, inside apply_batch, or before one is published.
+///         Only refresh_head_snapshot() builds them; a read never does, and
+///         may trail the last write by the time that takes.
+//##############################################################################
+boost::shared_ptr<const graph::CsrSnapshot>
+RangeAPI_v1::head_snapshot(const std::string &name, uint64_t version) const
+{
+    BOOST_LOG_FUNCTION();
+    if (!cfg_->csr_snapshot() || name != "primary"
+            || version != static_cast<uint64_t>(-1) || !batch_graphs_.empty()) {
+        return nullptr;
+    }
+    return graph::CsrSnapshot::current(*cfg_->db_backend(), name);
+}
+
+//##############################################################################
+/// get_node() on a snapshot
+///
+/// @return index of the node, or CsrSnapshot::npos where get_node() would
+///         return nullptr; throws where it would
+//##############################################################################
+graph::CsrSnapshot::index_t
+RangeAPI_v1::get_node(const graph::CsrSnapshot &snap,
+                      const std::string &env_name, const std::string &node_name) const
+{
+    BOOST_LOG_FUNCTION();
+    typedef graph::CsrSnapshot::index_t index_t;
+    auto lookup = [&snap](const std::string &name) -> index_t {
+        index_t i = snap.find(name);
+        return (i != graph::CsrSnapshot::npos && snap.present(i)) ? i : graph::CsrSnapshot::npos;
+    };
+
+    if(node_name.empty() && env_name.empty()) { return graph::CsrSnapshot::npos; }
+
+    index_t n;
+    if(node_name.empty() || env_name == node_name) {
+        n = lookup(env_name);
+        if(n != graph::CsrSnapshot::npos && snap.type(n) == node_type::ENVIRONMENT) {
+            return n;
+        }
+        THROW_STACK(graph::NodeNotFoundException(
+                        prefixed_node_name(env_name, node_name)));
+    }
+
+    if(env_name.empty()) {
+        n = lookup(node_name);
+        if(n != graph::CsrSnapshot::npos
+                && (snap.type(n) == node_type::STRING || snap.type(n) == node_type::HOST)) {
+            return n;
+        }
+        THROW_STACK(graph::NodeNotFoundException(
+                        prefixed_node_name(env_name, node_name)));
+    }
+
+    n = lookup(prefixed_node_name(env_name, node_name));
+    if(n != graph::CsrSnapshot::npos) {
+        return n;
+    }
+
+    n = lookup(node_name);
+    if(n != graph::CsrSnapshot::npos && snap.type(n) != node_type::HOST) {
+        THROW_STACK(graph::NodeNotFoundException(
+                    prefixed_node_name(env_name, node_name) + ':' + graph::NodeIface::node_type_names.find(snap.type(n))->second));
+    }
+    return n;
+}
+
 //##############################################################################
 //##############################################################################
 RangeStruct
 RangeAPI_v1::get_range_version(const std::string &timespec) const
 {
     RANGE_LOG_TIMED_FUNCTION() << "timespec: " << timespec;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
     struct timespec tm;
 
     if(parse_datetime(&tm, timespec.c_str(), NULL)) {
         std::time_t cmp_time = tm.tv_sec;
         LOG(debug7, "cmp_time") << cmp_time;
-        uint64_t found_version = cfg_->db_backend()->range_version();
-        auto changelist = cfg_->db_backend()->get_changelist();
-        for (auto c : changelist) {
-            std::time_t change_time;
-            uint64_t ver;
-            ::range::db::BackendInterface::range_change_t changes;
-            std::tie(change_time, ver, changes) = c;
-            LOG(debug7, "change_info") << "change_time: " << change_time << " ver: " << ver;
-
-            if (cmp_time > change_time) {
-                return RangeNumber(found_version);
-            }
-            found_version = ver;
+        uint64_t found_version = cfg_->db_backend()->range_version_at(cmp_time);
+        if (found_version == static_cast<uint64_t>(-1)) {
+            return RangeNull();
         }
-        return RangeNull();
+        return RangeNumber(found_version);
     }
     THROW_STACK(InvalidTimespecException(timespec));
 }
@@ -214,6 +375,33 @@ RangeStruct
 RangeAPI_v1::all_clusters(const std::string &env_name, uint64_t version) const
 {
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " version: " << version;
+    if (auto snap = head_snapshot("primary", version)) {
+        auto root = snap->find(env_name);
+        if(root == graph::CsrSnapshot::npos || !snap->present(root)) {
+            THROW_STACK(graph::NodeNotFoundException(env_name));
+        }
+        std::vector<bool> visited(snap->size());
+        RangeArray found;
+        std::stack<graph::CsrSnapshot::index_t> st;
+        st.push(root);
+        while (!st.empty()) {
+            auto v = st.top(); st.pop();
+            if (!visited[v]) {
+                visited[v] = true;
+                for (auto e : snap->forward(v)) {
+                    if (!visited[e]) {
+                        st.push(e);
+                    }
+                }
+                if (snap->type(v) == node_type::CLUSTER) {
+                    found.push_back(RangeString(unprefix_node_name(env_name, snap->name(v))));
+                }
+            }
+        }
+        return found;
+    }
+
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     auto n = primary->get_node(env_name);
@@ -221,21 +409,23 @@ RangeAPI_v1::all_clusters(const std::string &env_name, uint64_t version) const
         THROW_STACK(graph::NodeNotFoundException(env_name));
     }
 
-    std::unordered_map<std::string, bool> visited;
+    graph::IdAdjacency adj { primary, graph::NameInterner::get(*cfg_->db_backend(), "primary") };
+    graph::IdSet visited;
    
     RangeArray found;
-    std::stack<graph::NodeIface::node_t> st;
-    st.push(n);
+    std::stack<graph::IdAdjacency::id_t> st;
+    st.push(adj.id(n->name()));
 
     while (!st.empty()) {
         auto v = st.top(); st.pop();
-        if (visited.find(v->name()) == visited.end()) {
-            visited[v->name()] = true;
-            for (auto e : v->forward_edges()) {
-                st.push(e);
+        if (visited.insert(v)) {
+            for (auto e : adj.forward(v)) {
+                if (!visited.contains(e)) {
+                    st.push(e);
+                }
             }
-            if (v->type() == node_type::CLUSTER) {
-                found.push_back(RangeString(unprefix_node_name(env_name, v->name())));
+            if (adj.type(v) == node_type::CLUSTER) {
+                found.push_back(RangeString(unprefix_node_name(env_name, adj.name(v))));
             }
         }
     }
@@ -248,22 +438,12 @@ RangeStruct
 RangeAPI_v1::all_environments(uint64_t version) const
 {
     RANGE_LOG_TIMED_FUNCTION() << "version: " << version;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     uint64_t cmp_v = (version == static_cast<uint64_t>(-1)) ? primary->version() : version;
 
-    auto first = graph::makeVersionFilter(cmp_v, primary->cbegin(), primary->cend());
-    auto last = graph::makeVersionFilter(cmp_v, primary->cend(), primary->cend());
-
-    RangeArray found;
-
-    for(auto it = first; it != last; ++it) {
-        if (it->type() == node_type::ENVIRONMENT) {
-            found.push_back(it->name());
-        }
-    }
-
-    return found;
+    return RangeArray(primary->find_nodes_by_type(node_type::ENVIRONMENT, cmp_v));
 }
 
 
@@ -273,24 +453,41 @@ RangeStruct
 RangeAPI_v1::all_hosts(uint64_t version) const
 {
     RANGE_LOG_TIMED_FUNCTION() << "version: " << version;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     uint64_t cmp_v = (version == static_cast<uint64_t>(-1)) ? primary->version() : version;
 
-    auto first = graph::makeVersionFilter(cmp_v, primary->begin(), primary->end());
-    auto last = graph::makeVersionFilter(cmp_v, primary->end(), primary->end());
+    return RangeArray(primary->find_nodes_by_type(node_type::HOST, cmp_v));
+}
 
-    RangeArray found;
 
-    for(auto it = first; it != last; ++it) {
-        if (it->type() == node_type::HOST) {
-            found.push_back(it->name());
-        }
-    }
+//##############################################################################
+//##############################################################################
+RangeStruct
+RangeAPI_v1::find_nodes_by_prefix(const std::string &prefix, uint64_t version) const
+{
+    RANGE_LOG_TIMED_FUNCTION() << "prefix: " << prefix << " version: " << version;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
-    return found;
+    const auto primary = graphdb("primary", version);
+    return RangeArray(primary->find_nodes_by_prefix(prefix));
 }
 
+//##############################################################################
+//##############################################################################
+RangeStruct
+RangeAPI_v1::find_nodes_by_tag(const std::string &key, const std::string &value,
+        uint64_t version) const
+{
+    RANGE_LOG_TIMED_FUNCTION() << "key: " << key << " value: " << value << " version: " << version;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
+
+    const auto primary = graphdb("primary", version);
+    uint64_t cmp_v = (version == static_cast<uint64_t>(-1)) ? primary->version() : version;
+
+    return RangeArray(primary->find_nodes_by_tag(key, value, cmp_v));
+}
 
 //##############################################################################
 //##############################################################################
@@ -300,6 +497,7 @@ RangeAPI_v1::expand_range_expression(const std::string &env_name,
 {
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " expr: `" 
         << expression << "` version: " << version;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     try {
         const auto primary = graphdb("primary", version);
@@ -345,6 +543,28 @@ RangeAPI_v1::simple_expand(const std::string &env_name,
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " node_name: "
         << node_name << " version: " << version << " type: " 
         << graph::NodeIface::node_type_names.find(type)->second;
+    if (auto snap = head_snapshot("primary", version)) {
+        auto i = get_node(*snap, env_name, node_name);
+        if(i == graph::CsrSnapshot::npos) {
+            THROW_STACK(graph::NodeNotFoundException(prefixed_node_name(env_name, node_name)));
+        }
+        if (type != node_type::UNKNOWN && snap->type(i) != type) {
+            THROW_STACK(graph::IncorrectNodeTypeException(
+                    graph::NodeIface::node_type_names.find(snap->type(i))->second
+                    + " != "
+                    + graph::NodeIface::node_type_names.find(type)->second
+                ));
+        }
+        RangeArray found;
+        if(snap->type(i) != node_type::HOST) {
+            for (auto e : snap->forward(i)) {
+                found.push_back(unprefix_node_name(env_name, snap->name(e)));
+            }
+        }
+        return found;
+    }
+
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     auto n = get_node(primary, env_name, node_name);
@@ -366,8 +586,8 @@ RangeAPI_v1::simple_expand(const std::string &env_name,
     if (n) {
         RangeArray found;
         if(n->type() != node_type::HOST) {
-            for (auto v : n->forward_edges()) {
-                found.push_back(unprefix_node_name(env_name, v->name()));
+            for (auto &e : n->forward_edge_range()) {
+                found.push_back(unprefix_node_name(env_name, e.name.to_string()));
             }
         }
         return found;
@@ -404,6 +624,19 @@ RangeAPI_v1::get_keys(const std::string &env_name, const std::string &node_name,
 {
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " node_name: "
         << node_name << " version: " << version;
+    if (auto snap = head_snapshot("primary", version)) {
+        auto i = get_node(*snap, env_name, node_name);
+        if(i != graph::CsrSnapshot::npos) {
+            RangeArray found;
+            for(auto &kv : snap->tags(i)) {
+                found.push_back(kv.first);
+            }
+            return found;
+        }
+        THROW_STACK(graph::NodeNotFoundException(prefixed_node_name(env_name, node_name)));
+    }
+
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
 
@@ -428,6 +661,18 @@ RangeAPI_v1::fetch_key(const std::string &env_name, const std::string &node_name
 {
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " node_name: "
         << node_name << " key: " << key << " version: " << version;
+    if (auto snap = head_snapshot("primary", version)) {
+        auto i = get_node(*snap, env_name, node_name);
+        if(i != graph::CsrSnapshot::npos) {
+            if (auto values = snap->tag(i, key)) {
+                return RangeArray(*values);
+            }
+            THROW_STACK(graph::KeyNotFoundException(key));
+        }
+        THROW_STACK(graph::NodeNotFoundException(prefixed_node_name(env_name, node_name)));
+    }
+
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     auto n = get_node(primary, env_name, node_name);
@@ -452,6 +697,23 @@ RangeAPI_v1::fetch_all_keys(const std::string &env_name,
 {
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " node_name: "
         << node_name << " version: " << version;
+    if (auto snap = head_snapshot("primary", version)) {
+        auto i = get_node(*snap, env_name, node_name);
+        if(i != graph::CsrSnapshot::npos) {
+            RangeObject obj;
+            for (auto &t : snap->tags(i)) {
+                RangeArray a;
+                for (auto &val : t.second) {
+                    a.push_back(RangeString(val));
+                }
+                obj[t.first] = a;
+            }
+            return obj;
+        }
+        THROW_STACK(graph::NodeNotFoundException(prefixed_node_name(env_name, node_name)));
+    }
+
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     auto n = get_node(primary, env_name, node_name);
@@ -514,6 +776,7 @@ RangeAPI_v1::expand(const std::string &env_name, const std::string &node_name,
 {
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " node_name: "
         << node_name << " version: " << version << " depth: " << depth;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     const auto dependency = graphdb("dependency", version);                          
@@ -621,6 +884,89 @@ RangeAPI_v1::expand_env(const std::string &env_name,
     return expand(env_name, "", version, depth);
 }
 
+//##############################################################################
+/// What keeps the primary graph's HostClosure told of every version written
+//##############################################################################
+struct host_closure_feed_t {
+    std::mutex lock;
+    db::BackendInterface::subscription_t subscription;
+};
+
+static host_closure_feed_t&
+host_closure_feed(db::BackendInterface &backend)
+{
+    return *backend.graph_state<host_closure_feed_t>("primary", []() {
+                return boost::make_shared<host_closure_feed_t>();
+            });
+}
+
+//##############################################################################
+/// @return the primary graph's HostClosure, told of the changes up to head,
+///         or reset to head if they can't be had.
+/// MUST HOLD a read snapshot.
+//##############################################################################
+boost::shared_ptr<graph::HostClosure>
+RangeAPI_v1::host_closure() const
+{
+    BOOST_LOG_FUNCTION();
+    auto backend = cfg_->db_backend();
+    auto closure = graph::HostClosure::get(*backend, "primary");
+    auto &feed = host_closure_feed(*backend);
+
+    std::lock_guard<std::mutex> guard { feed.lock };
+    uint64_t head = backend->getGraphInstance("primary")->version();
+    if (feed.subscription && backend->catch_up_deltas("primary")
+            && closure->through() == head) {
+        return closure;
+    }
+    closure->reset(head);
+    feed.subscription = backend->subscribe_deltas("primary", head,
+            [closure](const db::BackendInterface::graph_delta_t &delta) {
+                closure->changed(delta.version, delta.nodes);
+            });
+    LOG(debug2, "host_closure_reset") << head;
+    return closure;
+}
+
+//##############################################################################
+//##############################################################################
+RangeStruct
+RangeAPI_v1::expand_hosts(const std::string &env_name,
+                          const std::string &node_name,
+                          uint64_t version) const
+{
+    RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " node_name: "
+        << node_name << " version: " << version;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
+
+    const auto primary = graphdb("primary", version);
+    auto n = get_node(primary, env_name, node_name);
+    if(!n) {
+        std::string errmsg { prefixed_node_name(env_name, node_name) };
+        THROW_STACK(graph::NodeNotFoundException(errmsg));
+    }
+
+    auto interner = graph::NameInterner::get(*cfg_->db_backend(), "primary");
+    graph::IdAdjacency adj { primary, interner };
+    graph::HostClosure::ids_t hosts;
+    if (batch_graphs_.empty()) {
+        uint64_t cmp_v = (version == static_cast<uint64_t>(-1)) ? primary->version() : version;
+        hosts = host_closure()->hosts(adj, adj.id(n->name()), cmp_v);
+    }
+    else {                                                                      // apply_batch writes belong to no version yet
+        hosts = graph::HostClosure::get(*cfg_->db_backend(), "primary")->hosts(adj, adj.id(n->name()),
+                static_cast<uint64_t>(-1));
+    }
+
+    std::vector<std::string> names;
+    names.reserve(hosts->size());
+    for (auto id : *hosts) {
+        names.push_back(unprefix_node_name(env_name, interner->name(id)));
+    }
+    std::sort(names.begin(), names.end());
+    return RangeArray(names);
+}
+
 //##############################################################################
 //##############################################################################
 RangeStruct
@@ -630,6 +976,25 @@ RangeAPI_v1::get_clusters(const std::string &env_name,
 {
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " node_name: " 
         << node_name << " version: " << version;
+    if (auto snap = head_snapshot("primary", version)) {
+        auto i = snap->find(prefixed_node_name(env_name, node_name));
+        if(i == graph::CsrSnapshot::npos || !snap->present(i)) {
+            i = snap->find(node_name);
+            if(i == graph::CsrSnapshot::npos || !snap->present(i)) {
+                THROW_STACK(graph::NodeNotFoundException(prefixed_node_name(env_name, node_name)));
+            }
+            if(snap->type(i) != node_type::ENVIRONMENT && snap->type(i) != node_type::HOST) {
+                THROW_STACK(graph::NodeNotFoundException(prefixed_node_name(env_name, node_name)));
+            }
+        }
+        RangeArray found;
+        for (auto e : snap->reverse(i)) {
+            found.push_back(unprefix_node_name(env_name, snap->name(e)));
+        }
+        return found;
+    }
+
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     auto n = primary->get_node(prefixed_node_name(env_name, node_name));
@@ -644,8 +1009,8 @@ RangeAPI_v1::get_clusters(const std::string &env_name,
     }
 
     RangeArray found;
-    for (auto e : n->reverse_edges()) {
-        found.push_back(unprefix_node_name(env_name, e->name()));
+    for (auto &e : n->reverse_edge_range()) {
+        found.push_back(unprefix_node_name(env_name, e.name.to_string()));
     }
     return found;
 }
@@ -661,6 +1026,7 @@ RangeAPI_v1::bfs_search_parents_for_first_key(const std::string &env_name,
 {
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " node_name: "
         << node_name << " key: " << key << " version: " << version;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     std::string found_in;
@@ -711,6 +1077,7 @@ RangeAPI_v1::dfs_search_parents_for_first_key(const std::string &env_name,
 {
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " node_name: "
         << node_name << " key: " << key << " version: " << version;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     std::string found_in;
@@ -785,6 +1152,7 @@ RangeAPI_v1::nearest_common_ancestor(//std::string &ancestor,
 {
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " node_name1: "
         << node1_name << " node2_name: " << node2_name<< " version: " << version;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     std::string ancestor;
@@ -883,6 +1251,7 @@ RangeAPI_v1::environment_topological_sort(const std::string &env_name,
 {
     RANGE_LOG_TIMED_FUNCTION() << "env_name: " << env_name << " version: "
         << version;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     const auto dependency = graphdb("dependency", version);                          
@@ -967,38 +1336,42 @@ RangeStruct
 RangeAPI_v1::find_orphaned_nodes(uint64_t version) const
 {
     RANGE_LOG_TIMED_FUNCTION() << " version: " << version;
+    auto snapshot = cfg_->db_backend()->read_snapshot();
 
     const auto primary = graphdb("primary", version);
     
-    std::unordered_map<std::string, bool> visited;
+    auto interner = graph::NameInterner::get(*cfg_->db_backend(), "primary");
+    graph::IdAdjacency adj { primary, interner };
+    graph::IdSet visited;
     auto all_envs = all_environments(version);
     for (auto env_variant : boost::get<RangeArray>(all_envs).values) {
         std::string env = boost::get<RangeString>(env_variant).value;
-        std::stack<graph::NodeIface::node_t> st;
-        st.push(primary->get_node(env));
+        std::stack<graph::IdAdjacency::id_t> st;
+        st.push(adj.id(env));
 
         while(!st.empty()) {
             auto v = st.top(); st.pop();
-            if (visited.find(v->name()) == visited.end()) {
-                visited[v->name()] = true;
-                for(auto e : v->forward_edges()) {
-                    st.push(e);
+            if (visited.insert(v)) {
+                for(auto e : adj.forward(v)) {
+                    if (!visited.contains(e)) {
+                        st.push(e);
+                    }
                 }
             }
         }
     }
 
     uint64_t cmp_v = (version == static_cast<uint64_t>(-1)) ? primary->version() : version;
-    auto first = graph::makeVersionFilter(cmp_v, primary->begin(), primary->end());
-    auto last = graph::makeVersionFilter(cmp_v, primary->end(), primary->end());
 
     RangeArray orphans;
 
-    for(auto it = first; it != last; ++it) {
-        if(visited.find(it->name()) == visited.end()) {
-            RangeString type { graph::NodeIface::node_type_names.find(it->type())->second };
-            RangeString name { it->name() };
-            orphans.push_back(RangeTuple(std::make_pair(type, name)));
+    for (auto &by_type : primary->nodes_by_type(cmp_v)) {                      // names and types only; no node records
+        RangeString type { graph::NodeIface::node_type_names.find(by_type.first)->second };
+        for (auto &name : by_type.second) {
+            auto id = interner->find(name);                                     // never seen, so never visited
+            if(id == graph::NameInterner::npos || !visited.contains(id)) {
+                orphans.push_back(RangeTuple(std::make_pair(type, RangeString(name))));
+            }
         }
     }
     return orphans;
@@ -1,1580 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: store.proto
-
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
-#include "store.pb.h"
-
-#include <algorithm>
-
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
-#include <google/protobuf/descriptor.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/reflection_ops.h>
-#include <google/protobuf/wire_format.h>
-// @@protoc_insertion_point(includes)
-
-namespace range {
-namespace stored {
-
-namespace {
-
-const ::google::protobuf::Descriptor* Request_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Request_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Request_Type_descriptor_ = NULL;
-const ::google::protobuf::Descriptor* Ack_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  Ack_reflection_ = NULL;
-const ::google::protobuf::EnumDescriptor* Ack_Type_descriptor_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_store_2eproto() {
-  protobuf_AddDesc_store_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "store.proto");
-  GOOGLE_CHECK(file != NULL);
-  Request_descriptor_ = file->message_type(0);
-  static const int Request_offsets_[13] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, crc_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, client_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, request_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, method_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, args_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, timestamp_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, proposal_num_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, proposer_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, sender_addr_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, sender_port_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, version_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, sequence_num_),
-  };
-  Request_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Request_descriptor_,
-      Request::default_instance_,
-      Request_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Request, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Request));
-  Request_Type_descriptor_ = Request_descriptor_->enum_type(0);
-  Ack_descriptor_ = file->message_type(1);
-  static const int Ack_offsets_[10] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, status_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, client_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, request_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, code_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, reason_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, type_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, proposal_num_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, proposer_id_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, next_proposal_num_),
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, sequence_num_),
-  };
-  Ack_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      Ack_descriptor_,
-      Ack::default_instance_,
-      Ack_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(Ack, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(Ack));
-  Ack_Type_descriptor_ = Ack_descriptor_->enum_type(0);
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_store_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Request_descriptor_, &Request::default_instance());
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    Ack_descriptor_, &Ack::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_store_2eproto() {
-  delete Request::default_instance_;
-  delete Request_reflection_;
-  delete Ack::default_instance_;
-  delete Ack_reflection_;
-}
-
-void protobuf_AddDesc_store_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\013store.proto\022\014range.stored\"\367\002\n\007Request\022"
-    "\013\n\003crc\030\001 \002(\r\022\021\n\tclient_id\030\002 \002(\t\022\022\n\nreque"
-    "st_id\030\003 \002(\004\022\016\n\006method\030\004 \002(\t\022\014\n\004args\030\005 \003("
-    "\t\022\021\n\ttimestamp\030\006 \001(\004\022(\n\004type\030\007 \001(\0162\032.ran"
-    "ge.stored.Request.Type\022\024\n\014proposal_num\030\010"
-    " \001(\004\022\023\n\013proposer_id\030\t \001(\004\022\023\n\013sender_addr"
-    "\030\n \001(\r\022\023\n\013sender_port\030\013 \001(\r\022\017\n\007version\030\014"
-    " \001(\004\022\024\n\014sequence_num\030\r \001(\004\"a\n\004Type\022\013\n\007RE"
-    "QUEST\020\001\022\013\n\007PREPARE\020\002\022\013\n\007PROPOSE\020\004\022\t\n\005LEA"
-    "RN\020\010\022\n\n\006REPLAY\020\020\022\014\n\010FAILOVER\020 \022\r\n\tHEARTB"
-    "EAT\020@\"\222\002\n\003Ack\022\016\n\006status\030\001 \002(\010\022\021\n\tclient_"
-    "id\030\002 \002(\t\022\022\n\nrequest_id\030\003 \002(\004\022\014\n\004code\030\004 \001"
-    "(\r\022\016\n\006reason\030\005 \001(\t\022$\n\004type\030\006 \001(\0162\026.range"
-    ".stored.Ack.Type\022\024\n\014proposal_num\030\007 \001(\004\022\023"
-    "\n\013proposer_id\030\010 \001(\004\022\031\n\021next_proposal_num"
-    "\030\t \001(\004\022\024\n\014sequence_num\030\n \001(\004\"4\n\004Type\022\007\n\003"
-    "ACK\020\001\022\013\n\007PROMISE\020\002\022\010\n\004NACK\020\004\022\014\n\010ACCEPTED"
-    "\020\010", 682);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "store.proto", &protobuf_RegisterTypes);
-  Request::default_instance_ = new Request();
-  Ack::default_instance_ = new Ack();
-  Request::default_instance_->InitAsDefaultInstance();
-  Ack::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_store_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_store_2eproto {
-  StaticDescriptorInitializer_store_2eproto() {
-    protobuf_AddDesc_store_2eproto();
-  }
-} static_descriptor_initializer_store_2eproto_;
-
-// ===================================================================
-
-const ::google::protobuf::EnumDescriptor* Request_Type_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Request_Type_descriptor_;
-}
-bool Request_Type_IsValid(int value) {
-  switch(value) {
-    case 1:
-    case 2:
-    case 4:
-    case 8:
-    case 16:
-    case 32:
-    case 64:
-      return true;
-    default:
-      return false;
-  }
-}
-
-#ifndef _MSC_VER
-const Request_Type Request::REQUEST;
-const Request_Type Request::PREPARE;
-const Request_Type Request::PROPOSE;
-const Request_Type Request::LEARN;
-const Request_Type Request::REPLAY;
-const Request_Type Request::FAILOVER;
-const Request_Type Request::HEARTBEAT;
-const Request_Type Request::Type_MIN;
-const Request_Type Request::Type_MAX;
-const int Request::Type_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Request::kCrcFieldNumber;
-const int Request::kClientIdFieldNumber;
-const int Request::kRequestIdFieldNumber;
-const int Request::kMethodFieldNumber;
-const int Request::kArgsFieldNumber;
-const int Request::kTimestampFieldNumber;
-const int Request::kTypeFieldNumber;
-const int Request::kProposalNumFieldNumber;
-const int Request::kProposerIdFieldNumber;
-const int Request::kSenderAddrFieldNumber;
-const int Request::kSenderPortFieldNumber;
-const int Request::kVersionFieldNumber;
-const int Request::kSequenceNumFieldNumber;
-#endif  // !_MSC_VER
-
-Request::Request()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void Request::InitAsDefaultInstance() {
-}
-
-Request::Request(const Request& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Request::SharedCtor() {
-  _cached_size_ = 0;
-  crc_ = 0u;
-  client_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  request_id_ = GOOGLE_ULONGLONG(0);
-  method_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  timestamp_ = GOOGLE_ULONGLONG(0);
-  type_ = 1;
-  proposal_num_ = GOOGLE_ULONGLONG(0);
-  proposer_id_ = GOOGLE_ULONGLONG(0);
-  sender_addr_ = 0u;
-  sender_port_ = 0u;
-  version_ = GOOGLE_ULONGLONG(0);
-  sequence_num_ = GOOGLE_ULONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
-
-Request::~Request() {
-  SharedDtor();
-}
-
-void Request::SharedDtor() {
-  if (client_id_ != &::google::protobuf::internal::kEmptyString) {
-    delete client_id_;
-  }
-  if (method_ != &::google::protobuf::internal::kEmptyString) {
-    delete method_;
-  }
-  if (this != default_instance_) {
-  }
-}
-
-void Request::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Request::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Request_descriptor_;
-}
-
-const Request& Request::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_store_2eproto();
-  return *default_instance_;
-}
-
-Request* Request::default_instance_ = NULL;
-
-Request* Request::New() const {
-  return new Request;
-}
-
-void Request::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    crc_ = 0u;
-    if (has_client_id()) {
-      if (client_id_ != &::google::protobuf::internal::kEmptyString) {
-        client_id_->clear();
-      }
-    }
-    request_id_ = GOOGLE_ULONGLONG(0);
-    if (has_method()) {
-      if (method_ != &::google::protobuf::internal::kEmptyString) {
-        method_->clear();
-      }
-    }
-    timestamp_ = GOOGLE_ULONGLONG(0);
-    type_ = 1;
-    proposal_num_ = GOOGLE_ULONGLONG(0);
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    proposer_id_ = GOOGLE_ULONGLONG(0);
-    sender_addr_ = 0u;
-    sender_port_ = 0u;
-    version_ = GOOGLE_ULONGLONG(0);
-    sequence_num_ = GOOGLE_ULONGLONG(0);
-  }
-  args_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Request::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required uint32 crc = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &crc_)));
-          set_has_crc();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_client_id;
-        break;
-      }
-
-      // required string client_id = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_client_id:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_client_id()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->client_id().data(), this->client_id().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_request_id;
-        break;
-      }
-
-      // required uint64 request_id = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_request_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &request_id_)));
-          set_has_request_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(34)) goto parse_method;
-        break;
-      }
-
-      // required string method = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_method:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_method()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->method().data(), this->method().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_args;
-        break;
-      }
-
-      // repeated string args = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_args:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_args()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->args(this->args_size() - 1).data(),
-            this->args(this->args_size() - 1).length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_args;
-        if (input->ExpectTag(48)) goto parse_timestamp;
-        break;
-      }
-
-      // optional uint64 timestamp = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_timestamp:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &timestamp_)));
-          set_has_timestamp();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(56)) goto parse_type;
-        break;
-      }
-
-      // optional .range.stored.Request.Type type = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_type:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::range::stored::Request_Type_IsValid(value)) {
-            set_type(static_cast< ::range::stored::Request_Type >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(7, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(64)) goto parse_proposal_num;
-        break;
-      }
-
-      // optional uint64 proposal_num = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_proposal_num:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &proposal_num_)));
-          set_has_proposal_num();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(72)) goto parse_proposer_id;
-        break;
-      }
-
-      // optional uint64 proposer_id = 9;
-      case 9: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_proposer_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &proposer_id_)));
-          set_has_proposer_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(80)) goto parse_sender_addr;
-        break;
-      }
-
-      // optional uint32 sender_addr = 10;
-      case 10: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_sender_addr:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &sender_addr_)));
-          set_has_sender_addr();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(88)) goto parse_sender_port;
-        break;
-      }
-
-      // optional uint32 sender_port = 11;
-      case 11: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_sender_port:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &sender_port_)));
-          set_has_sender_port();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(96)) goto parse_version;
-        break;
-      }
-
-      // optional uint64 version = 12;
-      case 12: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_version:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &version_)));
-          set_has_version();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(104)) goto parse_sequence_num;
-        break;
-      }
-
-      // optional uint64 sequence_num = 13;
-      case 13: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_sequence_num:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &sequence_num_)));
-          set_has_sequence_num();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void Request::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required uint32 crc = 1;
-  if (has_crc()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(1, this->crc(), output);
-  }
-
-  // required string client_id = 2;
-  if (has_client_id()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->client_id().data(), this->client_id().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->client_id(), output);
-  }
-
-  // required uint64 request_id = 3;
-  if (has_request_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->request_id(), output);
-  }
-
-  // required string method = 4;
-  if (has_method()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->method().data(), this->method().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      4, this->method(), output);
-  }
-
-  // repeated string args = 5;
-  for (int i = 0; i < this->args_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->args(i).data(), this->args(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      5, this->args(i), output);
-  }
-
-  // optional uint64 timestamp = 6;
-  if (has_timestamp()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(6, this->timestamp(), output);
-  }
-
-  // optional .range.stored.Request.Type type = 7;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      7, this->type(), output);
-  }
-
-  // optional uint64 proposal_num = 8;
-  if (has_proposal_num()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(8, this->proposal_num(), output);
-  }
-
-  // optional uint64 proposer_id = 9;
-  if (has_proposer_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(9, this->proposer_id(), output);
-  }
-
-  // optional uint32 sender_addr = 10;
-  if (has_sender_addr()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(10, this->sender_addr(), output);
-  }
-
-  // optional uint32 sender_port = 11;
-  if (has_sender_port()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(11, this->sender_port(), output);
-  }
-
-  // optional uint64 version = 12;
-  if (has_version()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(12, this->version(), output);
-  }
-
-  // optional uint64 sequence_num = 13;
-  if (has_sequence_num()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(13, this->sequence_num(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* Request::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required uint32 crc = 1;
-  if (has_crc()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(1, this->crc(), target);
-  }
-
-  // required string client_id = 2;
-  if (has_client_id()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->client_id().data(), this->client_id().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->client_id(), target);
-  }
-
-  // required uint64 request_id = 3;
-  if (has_request_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->request_id(), target);
-  }
-
-  // required string method = 4;
-  if (has_method()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->method().data(), this->method().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        4, this->method(), target);
-  }
-
-  // repeated string args = 5;
-  for (int i = 0; i < this->args_size(); i++) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->args(i).data(), this->args(i).length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(5, this->args(i), target);
-  }
-
-  // optional uint64 timestamp = 6;
-  if (has_timestamp()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(6, this->timestamp(), target);
-  }
-
-  // optional .range.stored.Request.Type type = 7;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      7, this->type(), target);
-  }
-
-  // optional uint64 proposal_num = 8;
-  if (has_proposal_num()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(8, this->proposal_num(), target);
-  }
-
-  // optional uint64 proposer_id = 9;
-  if (has_proposer_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(9, this->proposer_id(), target);
-  }
-
-  // optional uint32 sender_addr = 10;
-  if (has_sender_addr()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(10, this->sender_addr(), target);
-  }
-
-  // optional uint32 sender_port = 11;
-  if (has_sender_port()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(11, this->sender_port(), target);
-  }
-
-  // optional uint64 version = 12;
-  if (has_version()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(12, this->version(), target);
-  }
-
-  // optional uint64 sequence_num = 13;
-  if (has_sequence_num()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(13, this->sequence_num(), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
-}
-
-int Request::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required uint32 crc = 1;
-    if (has_crc()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->crc());
-    }
-
-    // required string client_id = 2;
-    if (has_client_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->client_id());
-    }
-
-    // required uint64 request_id = 3;
-    if (has_request_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->request_id());
-    }
-
-    // required string method = 4;
-    if (has_method()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->method());
-    }
-
-    // optional uint64 timestamp = 6;
-    if (has_timestamp()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->timestamp());
-    }
-
-    // optional .range.stored.Request.Type type = 7;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
-
-    // optional uint64 proposal_num = 8;
-    if (has_proposal_num()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->proposal_num());
-    }
-
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    // optional uint64 proposer_id = 9;
-    if (has_proposer_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->proposer_id());
-    }
-
-    // optional uint32 sender_addr = 10;
-    if (has_sender_addr()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->sender_addr());
-    }
-
-    // optional uint32 sender_port = 11;
-    if (has_sender_port()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->sender_port());
-    }
-
-    // optional uint64 version = 12;
-    if (has_version()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->version());
-    }
-
-    // optional uint64 sequence_num = 13;
-    if (has_sequence_num()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->sequence_num());
-    }
-
-  }
-  // repeated string args = 5;
-  total_size += 1 * this->args_size();
-  for (int i = 0; i < this->args_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->args(i));
-  }
-
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void Request::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Request* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Request*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
-
-void Request::MergeFrom(const Request& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  args_.MergeFrom(from.args_);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_crc()) {
-      set_crc(from.crc());
-    }
-    if (from.has_client_id()) {
-      set_client_id(from.client_id());
-    }
-    if (from.has_request_id()) {
-      set_request_id(from.request_id());
-    }
-    if (from.has_method()) {
-      set_method(from.method());
-    }
-    if (from.has_timestamp()) {
-      set_timestamp(from.timestamp());
-    }
-    if (from.has_type()) {
-      set_type(from.type());
-    }
-    if (from.has_proposal_num()) {
-      set_proposal_num(from.proposal_num());
-    }
-  }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_proposer_id()) {
-      set_proposer_id(from.proposer_id());
-    }
-    if (from.has_sender_addr()) {
-      set_sender_addr(from.sender_addr());
-    }
-    if (from.has_sender_port()) {
-      set_sender_port(from.sender_port());
-    }
-    if (from.has_version()) {
-      set_version(from.version());
-    }
-    if (from.has_sequence_num()) {
-      set_sequence_num(from.sequence_num());
-    }
-  }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Request::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Request::CopyFrom(const Request& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Request::IsInitialized() const {
-  if ((_has_bits_[0] & 0x0000000f) != 0x0000000f) return false;
-
-  return true;
-}
-
-void Request::Swap(Request* other) {
-  if (other != this) {
-    std::swap(crc_, other->crc_);
-    std::swap(client_id_, other->client_id_);
-    std::swap(request_id_, other->request_id_);
-    std::swap(method_, other->method_);
-    args_.Swap(&other->args_);
-    std::swap(timestamp_, other->timestamp_);
-    std::swap(type_, other->type_);
-    std::swap(proposal_num_, other->proposal_num_);
-    std::swap(proposer_id_, other->proposer_id_);
-    std::swap(sender_addr_, other->sender_addr_);
-    std::swap(sender_port_, other->sender_port_);
-    std::swap(version_, other->version_);
-    std::swap(sequence_num_, other->sequence_num_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata Request::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Request_descriptor_;
-  metadata.reflection = Request_reflection_;
-  return metadata;
-}
-
-
-// ===================================================================
-
-const ::google::protobuf::EnumDescriptor* Ack_Type_descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Ack_Type_descriptor_;
-}
-bool Ack_Type_IsValid(int value) {
-  switch(value) {
-    case 1:
-    case 2:
-    case 4:
-    case 8:
-      return true;
-    default:
-      return false;
-  }
-}
-
-#ifndef _MSC_VER
-const Ack_Type Ack::ACK;
-const Ack_Type Ack::PROMISE;
-const Ack_Type Ack::NACK;
-const Ack_Type Ack::ACCEPTED;
-const Ack_Type Ack::Type_MIN;
-const Ack_Type Ack::Type_MAX;
-const int Ack::Type_ARRAYSIZE;
-#endif  // _MSC_VER
-#ifndef _MSC_VER
-const int Ack::kStatusFieldNumber;
-const int Ack::kClientIdFieldNumber;
-const int Ack::kRequestIdFieldNumber;
-const int Ack::kCodeFieldNumber;
-const int Ack::kReasonFieldNumber;
-const int Ack::kTypeFieldNumber;
-const int Ack::kProposalNumFieldNumber;
-const int Ack::kProposerIdFieldNumber;
-const int Ack::kNextProposalNumFieldNumber;
-const int Ack::kSequenceNumFieldNumber;
-#endif  // !_MSC_VER
-
-Ack::Ack()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void Ack::InitAsDefaultInstance() {
-}
-
-Ack::Ack(const Ack& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void Ack::SharedCtor() {
-  _cached_size_ = 0;
-  status_ = false;
-  client_id_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  request_id_ = GOOGLE_ULONGLONG(0);
-  code_ = 0u;
-  reason_ = const_cast< ::std::string*>(&::google::protobuf::internal::kEmptyString);
-  type_ = 1;
-  proposal_num_ = GOOGLE_ULONGLONG(0);
-  proposer_id_ = GOOGLE_ULONGLONG(0);
-  next_proposal_num_ = GOOGLE_ULONGLONG(0);
-  sequence_num_ = GOOGLE_ULONGLONG(0);
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
-
-Ack::~Ack() {
-  SharedDtor();
-}
-
-void Ack::SharedDtor() {
-  if (client_id_ != &::google::protobuf::internal::kEmptyString) {
-    delete client_id_;
-  }
-  if (reason_ != &::google::protobuf::internal::kEmptyString) {
-    delete reason_;
-  }
-  if (this != default_instance_) {
-  }
-}
-
-void Ack::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* Ack::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return Ack_descriptor_;
-}
-
-const Ack& Ack::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_store_2eproto();
-  return *default_instance_;
-}
-
-Ack* Ack::default_instance_ = NULL;
-
-Ack* Ack::New() const {
-  return new Ack;
-}
-
-void Ack::Clear() {
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    status_ = false;
-    if (has_client_id()) {
-      if (client_id_ != &::google::protobuf::internal::kEmptyString) {
-        client_id_->clear();
-      }
-    }
-    request_id_ = GOOGLE_ULONGLONG(0);
-    code_ = 0u;
-    if (has_reason()) {
-      if (reason_ != &::google::protobuf::internal::kEmptyString) {
-        reason_->clear();
-      }
-    }
-    type_ = 1;
-    proposal_num_ = GOOGLE_ULONGLONG(0);
-    proposer_id_ = GOOGLE_ULONGLONG(0);
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    next_proposal_num_ = GOOGLE_ULONGLONG(0);
-    sequence_num_ = GOOGLE_ULONGLONG(0);
-  }
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool Ack::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // required bool status = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
-                 input, &status_)));
-          set_has_status();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(18)) goto parse_client_id;
-        break;
-      }
-
-      // required string client_id = 2;
-      case 2: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_client_id:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_client_id()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->client_id().data(), this->client_id().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(24)) goto parse_request_id;
-        break;
-      }
-
-      // required uint64 request_id = 3;
-      case 3: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_request_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &request_id_)));
-          set_has_request_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(32)) goto parse_code;
-        break;
-      }
-
-      // optional uint32 code = 4;
-      case 4: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_code:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
-                 input, &code_)));
-          set_has_code();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(42)) goto parse_reason;
-        break;
-      }
-
-      // optional string reason = 5;
-      case 5: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_reason:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->mutable_reason()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->reason().data(), this->reason().length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(48)) goto parse_type;
-        break;
-      }
-
-      // optional .range.stored.Ack.Type type = 6;
-      case 6: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_type:
-          int value;
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
-                 input, &value)));
-          if (::range::stored::Ack_Type_IsValid(value)) {
-            set_type(static_cast< ::range::stored::Ack_Type >(value));
-          } else {
-            mutable_unknown_fields()->AddVarint(6, value);
-          }
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(56)) goto parse_proposal_num;
-        break;
-      }
-
-      // optional uint64 proposal_num = 7;
-      case 7: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_proposal_num:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &proposal_num_)));
-          set_has_proposal_num();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(64)) goto parse_proposer_id;
-        break;
-      }
-
-      // optional uint64 proposer_id = 8;
-      case 8: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_proposer_id:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &proposer_id_)));
-          set_has_proposer_id();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(72)) goto parse_next_proposal_num;
-        break;
-      }
-
-      // optional uint64 next_proposal_num = 9;
-      case 9: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_next_proposal_num:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &next_proposal_num_)));
-          set_has_next_proposal_num();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(80)) goto parse_sequence_num;
-        break;
-      }
-
-      // optional uint64 sequence_num = 10;
-      case 10: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_VARINT) {
-         parse_sequence_num:
-          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
-                 input, &sequence_num_)));
-          set_has_sequence_num();
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void Ack::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // required bool status = 1;
-  if (has_status()) {
-    ::google::protobuf::internal::WireFormatLite::WriteBool(1, this->status(), output);
-  }
-
-  // required string client_id = 2;
-  if (has_client_id()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->client_id().data(), this->client_id().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      2, this->client_id(), output);
-  }
-
-  // required uint64 request_id = 3;
-  if (has_request_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(3, this->request_id(), output);
-  }
-
-  // optional uint32 code = 4;
-  if (has_code()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt32(4, this->code(), output);
-  }
-
-  // optional string reason = 5;
-  if (has_reason()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->reason().data(), this->reason().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      5, this->reason(), output);
-  }
-
-  // optional .range.stored.Ack.Type type = 6;
-  if (has_type()) {
-    ::google::protobuf::internal::WireFormatLite::WriteEnum(
-      6, this->type(), output);
-  }
-
-  // optional uint64 proposal_num = 7;
-  if (has_proposal_num()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(7, this->proposal_num(), output);
-  }
-
-  // optional uint64 proposer_id = 8;
-  if (has_proposer_id()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(8, this->proposer_id(), output);
-  }
-
-  // optional uint64 next_proposal_num = 9;
-  if (has_next_proposal_num()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(9, this->next_proposal_num(), output);
-  }
-
-  // optional uint64 sequence_num = 10;
-  if (has_sequence_num()) {
-    ::google::protobuf::internal::WireFormatLite::WriteUInt64(10, this->sequence_num(), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* Ack::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // required bool status = 1;
-  if (has_status()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteBoolToArray(1, this->status(), target);
-  }
-
-  // required string client_id = 2;
-  if (has_client_id()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->client_id().data(), this->client_id().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        2, this->client_id(), target);
-  }
-
-  // required uint64 request_id = 3;
-  if (has_request_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(3, this->request_id(), target);
-  }
-
-  // optional uint32 code = 4;
-  if (has_code()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt32ToArray(4, this->code(), target);
-  }
-
-  // optional string reason = 5;
-  if (has_reason()) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->reason().data(), this->reason().length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target =
-      ::google::protobuf::internal::WireFormatLite::WriteStringToArray(
-        5, this->reason(), target);
-  }
-
-  // optional .range.stored.Ack.Type type = 6;
-  if (has_type()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteEnumToArray(
-      6, this->type(), target);
-  }
-
-  // optional uint64 proposal_num = 7;
-  if (has_proposal_num()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(7, this->proposal_num(), target);
-  }
-
-  // optional uint64 proposer_id = 8;
-  if (has_proposer_id()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(8, this->proposer_id(), target);
-  }
-
-  // optional uint64 next_proposal_num = 9;
-  if (has_next_proposal_num()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(9, this->next_proposal_num(), target);
-  }
-
-  // optional uint64 sequence_num = 10;
-  if (has_sequence_num()) {
-    target = ::google::protobuf::internal::WireFormatLite::WriteUInt64ToArray(10, this->sequence_num(), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
-}
-
-int Ack::ByteSize() const {
-  int total_size = 0;
-
-  if (_has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    // required bool status = 1;
-    if (has_status()) {
-      total_size += 1 + 1;
-    }
-
-    // required string client_id = 2;
-    if (has_client_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->client_id());
-    }
-
-    // required uint64 request_id = 3;
-    if (has_request_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->request_id());
-    }
-
-    // optional uint32 code = 4;
-    if (has_code()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt32Size(
-          this->code());
-    }
-
-    // optional string reason = 5;
-    if (has_reason()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::StringSize(
-          this->reason());
-    }
-
-    // optional .range.stored.Ack.Type type = 6;
-    if (has_type()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::EnumSize(this->type());
-    }
-
-    // optional uint64 proposal_num = 7;
-    if (has_proposal_num()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->proposal_num());
-    }
-
-    // optional uint64 proposer_id = 8;
-    if (has_proposer_id()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->proposer_id());
-    }
-
-  }
-  if (_has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    // optional uint64 next_proposal_num = 9;
-    if (has_next_proposal_num()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->next_proposal_num());
-    }
-
-    // optional uint64 sequence_num = 10;
-    if (has_sequence_num()) {
-      total_size += 1 +
-        ::google::protobuf::internal::WireFormatLite::UInt64Size(
-          this->sequence_num());
-    }
-
-  }
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void Ack::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const Ack* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const Ack*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
-
-void Ack::MergeFrom(const Ack& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  if (from._has_bits_[0 / 32] & (0xffu << (0 % 32))) {
-    if (from.has_status()) {
-      set_status(from.status());
-    }
-    if (from.has_client_id()) {
-      set_client_id(from.client_id());
-    }
-    if (from.has_request_id()) {
-      set_request_id(from.request_id());
-    }
-    if (from.has_code()) {
-      set_code(from.code());
-    }
-    if (from.has_reason()) {
-      set_reason(from.reason());
-    }
-    if (from.has_type()) {
-      set_type(from.type());
-    }
-    if (from.has_proposal_num()) {
-      set_proposal_num(from.proposal_num());
-    }
-    if (from.has_proposer_id()) {
-      set_proposer_id(from.proposer_id());
-    }
-  }
-  if (from._has_bits_[8 / 32] & (0xffu << (8 % 32))) {
-    if (from.has_next_proposal_num()) {
-      set_next_proposal_num(from.next_proposal_num());
-    }
-    if (from.has_sequence_num()) {
-      set_sequence_num(from.sequence_num());
-    }
-  }
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void Ack::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Ack::CopyFrom(const Ack& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Ack::IsInitialized() const {
-  if ((_has_bits_[0] & 0x00000007) != 0x00000007) return false;
-
-  return true;
-}
-
-void Ack::Swap(Ack* other) {
-  if (other != this) {
-    std::swap(status_, other->status_);
-    std::swap(client_id_, other->client_id_);
-    std::swap(request_id_, other->request_id_);
-    std::swap(code_, other->code_);
-    std::swap(reason_, other->reason_);
-    std::swap(type_, other->type_);
-    std::swap(proposal_num_, other->proposal_num_);
-    std::swap(proposer_id_, other->proposer_id_);
-    std::swap(next_proposal_num_, other->next_proposal_num_);
-    std::swap(sequence_num_, other->sequence_num_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata Ack::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = Ack_descriptor_;
-  metadata.reflection = Ack_reflection_;
-  return metadata;
-}
-
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace stored
-}  // namespace range
-
-// @@protoc_insertion_point(global_scope)
@@ -37,6 +37,15 @@ RequestQueue::verify_request(const Request& req)
     if(req.method() == "none") {
         return true;
     }
+    if (req.method() == "apply_batch") {                                        // any number of arguments; see decode_batch
+        try {
+            range::RangeAPI_v1::decode_batch({ req.args().begin(), req.args().end() });
+        } catch(range::IncorrectNumberOfArguments &e) {
+            return false;
+        }
+        return true;
+    }
+
     auto it = range::RangeAPI_v1::num_arguments.find(req.method());
     if (it == range::RangeAPI_v1::num_arguments.end()) {
         return false;
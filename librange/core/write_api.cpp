@@ -81,7 +81,9 @@ const std::map<std::string, std::function<bool(RangeAPI_v1*, std::vector<std::st
         { SYMTABLE_ENTRY4(remove_node_key_value) },
         { SYMTABLE_ENTRY3(remove_key_from_node) },
         { SYMTABLE_ENTRY4(add_node_ext_dependency) },
-        { SYMTABLE_ENTRY4(remove_node_ext_dependency) }
+        { SYMTABLE_ENTRY4(remove_node_ext_dependency) },
+        { "apply_batch", [](RangeAPI_v1 *inst, std::vector<std::string> args, uint64_t id) -> bool {
+            return inst->apply_batch(RangeAPI_v1::decode_batch(args), id); } }
     };
 
 
@@ -115,6 +117,131 @@ process_ack(stored::Ack &ack) {
     return false;
 }
 
+//##############################################################################
+// Within apply_batch the batch's own range transaction covers each call
+//##############################################################################
+db::BackendInterface::txn_type_p
+RangeAPI_v1::start_range_txn(db::RangeTxn::req_type_p req)
+{
+    BOOST_LOG_FUNCTION();
+    if (!batch_graphs_.empty()) {
+        return nullptr;
+    }
+    return cfg_->db_backend()->startRangeTransaction(req);
+}
+
+//##############################################################################
+// Within apply_batch the batch's graph transactions cover each call, so the
+// graph is versioned (update_versions) once for the whole batch
+//##############################################################################
+boost::shared_ptr<graph::GraphTxnIface>
+RangeAPI_v1::start_graph_txn(boost::shared_ptr<graph::GraphInterface> graph)
+{
+    BOOST_LOG_FUNCTION();
+    if (!batch_graphs_.empty()) {
+        return nullptr;
+    }
+    return graph->start_txn();
+}
+
+//##############################################################################
+//##############################################################################
+std::vector<std::string>
+RangeAPI_v1::encode_batch(const std::vector<Mutation> &mutations)
+{
+    BOOST_LOG_FUNCTION();
+    std::vector<std::string> args;
+    for (auto &m : mutations) {
+        auto it = num_arguments.find(m.method);
+        if (it == num_arguments.end()) {
+            THROW_STACK(IncorrectNumberOfArguments("unknown method in batch: " + m.method));
+        }
+        if (m.args.size() != it->second) {
+            THROW_STACK(IncorrectNumberOfArguments("incorrect # of arguments for " + m.method));
+        }
+        args.push_back(m.method);
+        args.push_back(std::to_string(static_cast<unsigned long long>(m.args.size())));
+        args.insert(args.end(), m.args.begin(), m.args.end());
+    }
+    return args;
+}
+
+//##############################################################################
+//##############################################################################
+std::vector<RangeAPI_v1::Mutation>
+RangeAPI_v1::decode_batch(const std::vector<std::string> &args)
+{
+    BOOST_LOG_FUNCTION();
+    std::vector<Mutation> mutations;
+    size_t i = 0;
+    while (i < args.size()) {
+        if (args.size() - i < 2) {
+            THROW_STACK(IncorrectNumberOfArguments("truncated batch"));
+        }
+        Mutation m { args[i], {} };
+        auto it = num_arguments.find(m.method);
+        if (it == num_arguments.end()) {
+            THROW_STACK(IncorrectNumberOfArguments("unknown method in batch: " + m.method));
+        }
+        if (args[i + 1] != std::to_string(static_cast<unsigned long long>(it->second))
+                || args.size() - i - 2 < it->second) {
+            THROW_STACK(IncorrectNumberOfArguments("incorrect # of arguments for " + m.method));
+        }
+        auto first = args.begin() + i + 2;
+        m.args.assign(first, first + it->second);
+        mutations.push_back(std::move(m));
+        i += 2 + it->second;
+    }
+    return mutations;
+}
+
+//##############################################################################
+//##############################################################################
+bool
+RangeAPI_v1::apply_batch(const std::vector<Mutation> &mutations, uint64_t id)
+{
+    RANGE_LOG_TIMED_FUNCTION() << "mutations: " << mutations.size();
+    if (mutations.empty()) {
+        return true;
+    }
+
+    ::range::stored::WriteRequest req { cfg_, "apply_batch" };
+    for (auto &arg : encode_batch(mutations)) {
+        req.add_arg(arg);
+    }
+    if (cfg_->use_stored()) {
+        auto ack = req.send();
+        return process_ack(ack);
+    }
+    auto r = req.req();
+    r->set_proposer_id(id);
+    auto rtxn = start_range_txn(r);
+
+    auto primary = graphdb("primary", -1);                                      // held open across the batch, so the graph
+    auto ptxn = primary->start_txn();                                           // versions (and update_versions) happen once
+    auto dependency = graphdb("dependency", -1);
+    auto dtxn = dependency->start_txn();
+
+    batch_graphs_ = { { "primary", primary }, { "dependency", dependency } };
+    try {
+        for (auto &m : mutations) {
+            if (!write_api_symtable.find(m.method)->second(this, m.args, id)) {
+                THROW_STACK(Exception("batched " + m.method + " failed"));
+            }
+        }
+    } catch(...) {
+        batch_graphs_.clear();
+        for (auto &txn : { ptxn, dtxn }) {                                      // none of the batch happens
+            if (txn) {
+                txn->abort();
+            }
+        }
+        throw;
+    }
+    batch_graphs_.clear();
+    return true;
+}
+
 //##############################################################################
 //##############################################################################
 bool
@@ -134,10 +261,10 @@ RangeAPI_v1::create_env(const std::string &env_name, uint64_t id)
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     for (auto g : { graphdb("primary", -1), graphdb("dependency", -1) }) {
-        auto txn = g->start_txn();
+        auto txn = start_graph_txn(g);
         auto n = g->create(env_name);
         if(n) {
             n->set_type(node_type::ENVIRONMENT);
@@ -163,10 +290,10 @@ RangeAPI_v1::remove_env(const std::string &env_name, uint64_t id)
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     for (auto g : { graphdb("primary", -1), graphdb("dependency", -1) }) {
-        auto txn = g->start_txn();
+        auto txn = start_graph_txn(g);
         auto n = g->get_node(env_name);
         if(n) {
             if(n->type() != node_type::ENVIRONMENT) {
@@ -192,9 +319,9 @@ RangeAPI_v1::add_cluster_to_env(const std::string &env_name,
         << cluster_name;
 
     auto primary = graphdb("primary", -1);
-    auto ptxn = primary->start_txn();
+    auto ptxn = start_graph_txn(primary);
     auto dependency = graphdb("dependency", -1);
-    auto dtxn = dependency->start_txn();
+    auto dtxn = start_graph_txn(dependency);
 
     auto env = primary->get_node(env_name);
     if(!env) {
@@ -224,7 +351,7 @@ RangeAPI_v1::add_cluster_to_env(const std::string &env_name,
 
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     if (!n) {
         LOG(notice, "nonexistent_cluster") << "node "
@@ -263,7 +390,7 @@ RangeAPI_v1::remove_cluster_from_env(const std::string &env_name,
         << cluster_name;
 
     auto primary = graphdb("primary", -1);
-    auto ptxn = primary->start_txn();
+    auto ptxn = start_graph_txn(primary);
 
     auto env = primary->get_node(env_name);
     auto n = primary->get_node(prefixed_node_name(env_name, cluster_name));
@@ -295,7 +422,7 @@ RangeAPI_v1::remove_cluster_from_env(const std::string &env_name,
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     if(!env->remove_forward_edge(n, true)) {
         THROW_STACK(graph::EdgeNotFoundException(n->name()));
@@ -315,9 +442,9 @@ RangeAPI_v1::add_cluster_to_cluster(const std::string &env_name,
         << parent_cluster << " child_cluster: " << child_cluster;
 
     auto primary = graphdb("primary", -1);
-    auto ptxn = primary->start_txn();
+    auto ptxn = start_graph_txn(primary);
     auto dependency = graphdb("dependency", -1);
-    auto dtxn = dependency->start_txn();
+    auto dtxn = start_graph_txn(dependency);
 
     auto parent = primary->get_node(prefixed_node_name(env_name, parent_cluster));
     if(!parent) {
@@ -348,7 +475,7 @@ RangeAPI_v1::add_cluster_to_cluster(const std::string &env_name,
 
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     if (!n) {
         n = primary->create(prefixed_node_name(env_name, child_cluster));
@@ -383,7 +510,7 @@ RangeAPI_v1::remove_cluster_from_cluster(const std::string &env_name,
         << parent_cluster << " child_cluster: " << child_cluster;
 
     auto primary = graphdb("primary", -1);
-    auto ptxn = primary->start_txn();
+    auto ptxn = start_graph_txn(primary);
 
     auto parent = primary->get_node(prefixed_node_name(env_name, parent_cluster));
     auto n = primary->get_node(prefixed_node_name(env_name, child_cluster));
@@ -418,7 +545,7 @@ RangeAPI_v1::remove_cluster_from_cluster(const std::string &env_name,
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     if(!parent->remove_forward_edge(n, true)) {
         THROW_STACK(graph::EdgeNotFoundException(n->name()));
@@ -437,9 +564,9 @@ RangeAPI_v1::remove_cluster(const std::string &env_name,
         << cluster_name;
 
     auto primary = graphdb("primary", -1);
-    auto ptxn = primary->start_txn();
+    auto ptxn = start_graph_txn(primary);
     auto dependency = graphdb("dependency", -1);
-    auto dtxn = dependency->start_txn();
+    auto dtxn = start_graph_txn(dependency);
     auto n = primary->get_node(prefixed_node_name(env_name, cluster_name));
     if(!n) {
         THROW_STACK(graph::NodeNotFoundException(prefixed_node_name(env_name, cluster_name)));
@@ -459,7 +586,7 @@ RangeAPI_v1::remove_cluster(const std::string &env_name,
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     primary->remove(n);
     dependency->remove(n);
@@ -478,9 +605,9 @@ RangeAPI_v1::add_host_to_cluster(const std::string &env_name,
         << parent_cluster << " hostname " << hostname;
 
     auto primary = graphdb("primary", -1);
-    auto ptxn = primary->start_txn();
+    auto ptxn = start_graph_txn(primary);
     auto dependency = graphdb("dependency", -1);
-    auto dtxn = dependency->start_txn();
+    auto dtxn = start_graph_txn(dependency);
 
     auto parent = primary->get_node(prefixed_node_name(env_name, parent_cluster));
     if(!parent) {
@@ -510,7 +637,7 @@ RangeAPI_v1::add_host_to_cluster(const std::string &env_name,
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     if(n) {
         LOG(debug9, "found_host_being_added") << hostname;
@@ -585,7 +712,7 @@ RangeAPI_v1::remove_host_from_cluster(const std::string &env_name,
         << parent_cluster << " hostname: " << hostname;
 
     auto primary = graphdb("primary", -1);
-    auto ptxn = primary->start_txn();
+    auto ptxn = start_graph_txn(primary);
     auto parent = primary->get_node(prefixed_node_name(env_name, parent_cluster));
     auto n = primary->get_node(hostname);
 
@@ -618,7 +745,7 @@ RangeAPI_v1::remove_host_from_cluster(const std::string &env_name,
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
 
     if(!n->remove_reverse_edge(parent, true)) {
@@ -642,11 +769,11 @@ RangeAPI_v1::add_host(const std::string &hostname, uint64_t id)
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
 
     for (auto g : { graphdb("primary", -1), graphdb("dependency", -1) }) {
-        auto gtxn = g->start_txn();
+        auto gtxn = start_graph_txn(g);
         auto n = g->get_node(hostname);
         if(n) {
             THROW_STACK(NodeExistsException(n->name()));
@@ -672,9 +799,9 @@ RangeAPI_v1::remove_host(const std::string &env_name,
         << hostname;
 
     auto primary = graphdb("primary", -1);
-    auto ptxn = primary->start_txn();
+    auto ptxn = start_graph_txn(primary);
     auto dependency = graphdb("dependency", -1);
-    auto dtxn = dependency->start_txn();
+    auto dtxn = start_graph_txn(dependency);
     auto n = primary->get_node(hostname);
 
     if(!n) {
@@ -715,7 +842,7 @@ RangeAPI_v1::remove_host(const std::string &env_name,
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
 
     primary->remove(n);
@@ -735,7 +862,7 @@ RangeAPI_v1::add_node_key_value(const std::string &env_name, const std::string &
         << node_name << " key: " << key << " value " << value;
 
     auto primary = graphdb("primary", -1);
-    auto ptxn = primary->start_txn();
+    auto ptxn = start_graph_txn(primary);
 
     auto n = get_node(primary, env_name, node_name);
     //auto n = primary->get_node(prefixed_node_name(env_name, node_name));
@@ -769,7 +896,7 @@ RangeAPI_v1::add_node_key_value(const std::string &env_name, const std::string &
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     values.push_back(value);
     return n->update_tag(key, values);
@@ -787,7 +914,7 @@ RangeAPI_v1::remove_node_key_value(const std::string &env_name, const std::strin
         << node_name << " key: " << key << " value " << value;
 
     auto primary = graphdb("primary", -1);
-    auto ptxn = primary->start_txn();
+    auto ptxn = start_graph_txn(primary);
 
     auto n = get_node(primary, env_name, node_name);
     //auto n = primary->get_node(prefixed_node_name(env_name, node_name));
@@ -826,7 +953,7 @@ RangeAPI_v1::remove_node_key_value(const std::string &env_name, const std::strin
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     if(!n->update_tag(key, new_values)) {
         THROW_STACK(CreateNodeException("Unable to update tag"));
@@ -846,7 +973,7 @@ RangeAPI_v1::remove_key_from_node(const std::string &env_name,
         << node_name << " key: " << key;
 
     auto primary = graphdb("primary", -1);
-    auto ptxn = primary->start_txn();
+    auto ptxn = start_graph_txn(primary);
 
     auto n = get_node(primary, env_name, node_name);
     //auto n = primary->get_node(prefixed_node_name(env_name, node_name));
@@ -864,7 +991,7 @@ RangeAPI_v1::remove_key_from_node(const std::string &env_name,
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     if(!n->delete_tag(key)) {
         THROW_STACK(graph::EdgeNotFoundException(key));
@@ -886,7 +1013,7 @@ RangeAPI_v1::add_node_ext_dependency(const std::string &env_name,
         << " dependency_name: " << dependency_name;
 
     auto dep = graphdb("dependency", -1);
-    auto dtxn = dep->start_txn();
+    auto dtxn = start_graph_txn(dep);
     auto n = dep->get_node(prefixed_node_name(env_name, node_name));
     auto d = dep->get_node(prefixed_node_name(dependency_env, dependency_name));
 
@@ -914,7 +1041,7 @@ RangeAPI_v1::add_node_ext_dependency(const std::string &env_name,
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
 
     if(!n->add_forward_edge(d, true)) {
@@ -949,7 +1076,7 @@ RangeAPI_v1::remove_node_ext_dependency(const std::string &env_name,
         << " dependency_name: " << dependency_name;
 
     auto dep = graphdb("dependency", -1);
-    auto dtxn = dep->start_txn();
+    auto dtxn = start_graph_txn(dep);
     auto n = dep->get_node(prefixed_node_name(env_name, node_name));
     auto d = dep->get_node(prefixed_node_name(dependency_env, dependency_name));
 
@@ -971,7 +1098,7 @@ RangeAPI_v1::remove_node_ext_dependency(const std::string &env_name,
     }
     auto r = req.req();
     r->set_proposer_id(id);
-    auto rtxn = cfg_->db_backend()->startRangeTransaction(r);
+    auto rtxn = start_range_txn(r);
 
     if(!n->remove_forward_edge(d)) {
         THROW_STACK(graph::EdgeNotFoundException(dependency_name));
@@ -20,6 +20,10 @@
 
 #include "berkeley_dbcxx_txlog.h"
 #include "berkeley_dbcxx_range_txn.h"
+#include "node_info_cache.h"
+#include "node_tag_index.h"
+#include "node_type_index.h"
+#include "packed_version_index.h"
 
 namespace range { namespace db {
 
@@ -59,6 +63,7 @@ BerkeleyDB::backend_shutdown()
 }
 
 static ::range::EmitterModuleRegistration BerkeleyDBLogModule { "db.BerkeleyDB" };
+
 //##############################################################################
 //##############################################################################
 BerkeleyDB::BerkeleyDB(const boost::shared_ptr<db::ConfigIface> db_config)
@@ -66,6 +71,7 @@ BerkeleyDB::BerkeleyDB(const boost::shared_ptr<db::ConfigIface> db_config)
         env_(BerkeleyDBCXXEnv::get(db_config_)), 
         log(BerkeleyDBLogModule)
 {
+    NodeInfoCache::get()->set_capacity(db_config_->node_cache_size());
 }
 
 //##############################################################################
@@ -142,7 +148,15 @@ BerkeleyDB::createGraphInstance(const std::string& name)
     std::string * n = listbuf.add_name();
     n->assign(name);
     info_->commit_record(std::make_tuple(record_type::GRAPH_META, "graph_list", 0, listbuf.SerializeAsString()));
-    return this->getGraphInstance(name);
+
+    auto inst = this->getGraphInstance(name);
+    auto lock = inst->write_lock(record_type::NODE_META, "");
+    auto txn = inst->start_txn();
+    NodeTypeIndex(inst).set_complete_from(0);                                   // indexed from the first node on
+    NodeTagIndex(inst).set_complete_from(0);
+    txn->flush();
+    txn->abort();
+    return inst;
 }
 
 //##############################################################################
@@ -290,7 +304,111 @@ BerkeleyDB::add_new_range_version()
     ts->set_msec(cur_time.tv_usec / 1000);
 
     changes.set_current_version(changes.current_version() + 1);
+
+    PackedVersionIndex index { info_->get_record(record_type::GRAPH_META, "range_version_index") };
+    size_t n_indexed = changes.change_size() - 1;
+    if(index.size() != n_indexed) {                                             // changelist predates the index, build it
+        LOG(notice, "rebuilding_range_version_index") << n_indexed << " versions";
+        index.clear();
+        index.reserve(n_indexed + 1);
+        for (size_t c_idx = 0; c_idx < n_indexed; ++c_idx) {
+            index.append(changes.change(c_idx).timestamp().seconds(), c_idx + 1);
+        }
+    }
+    index.append(ts->seconds(), changes.change_size());
+
     info_->commit_record(std::make_tuple(record_type::GRAPH_META, "range_changelist", 0, changes.SerializeAsString()));
+    info_->commit_record(std::make_tuple(record_type::GRAPH_META, "range_version_index", 0, index.str()));
+}
+
+//##############################################################################
+// Rewrite graph name in the layout the config asks for (graph_access_method),
+// which otherwise only applies to graphs created after it is set. Nothing
+// else may be using the graph; stop stored first.
+//##############################################################################
+bool
+BerkeleyDB::convert_graph(const std::string &name)
+{
+    RANGE_LOG_TIMED_FUNCTION();
+    BerkeleyDBCXXDb::close_db(name);
+    DBTYPE method = (db_config_->graph_access_method() == ConfigIface::access_method::BTREE)
+        ? DB_BTREE : DB_HASH;
+    return BerkeleyDBCXXDb::convert(name, method, env_);
+}
+
+//##############################################################################
+// Commits made on this thread until end_write_batch() are made durable
+// together, by end_write_batch()
+//##############################################################################
+void
+BerkeleyDB::begin_write_batch()
+{
+    RANGE_LOG_FUNCTION();
+    env_->group_commit().begin_batch();
+}
+
+//##############################################################################
+//##############################################################################
+void
+BerkeleyDB::end_write_batch()
+{
+    RANGE_LOG_FUNCTION();
+    env_->group_commit().end_batch();
+}
+
+//##############################################################################
+// Reads made on this thread while the snapshot is held share its transaction,
+// rather than each beginning and committing their own
+//##############################################################################
+BerkeleyDB::read_snapshot_t
+BerkeleyDB::read_snapshot() const
+{
+    RANGE_LOG_FUNCTION();
+    return boost::make_shared<BerkeleyDBCXXSnapshot>(env_->acquire_DbTxn_lock(false));
+}
+
+//##############################################################################
+//##############################################################################
+BerkeleyDB::subscription_t
+BerkeleyDB::subscribe_deltas(const std::string &graph, uint64_t from_version,
+        delta_fn_t fn)
+{
+    RANGE_LOG_FUNCTION();
+    return deltas_.subscribe(graph, from_version, fn);
+}
+
+//##############################################################################
+// The changes are the per-version changelist records BerkeleyDBCXXTxn::commit
+// writes; read under one snapshot so the version and its records agree
+//##############################################################################
+bool
+BerkeleyDB::catch_up_deltas(const std::string &graph)
+{
+    RANGE_LOG_FUNCTION();
+    auto snapshot = this->read_snapshot();
+    return deltas_.catch_up(graph, *this->getGraphInstance(graph));
+}
+
+//##############################################################################
+//##############################################################################
+uint64_t
+BerkeleyDB::range_version_at(std::time_t when)
+{
+    RANGE_LOG_FUNCTION();
+    this->init_info();
+    PackedVersionIndex index { info_->get_record(record_type::GRAPH_META, "range_version_index") };
+    if(index.empty()) {
+        return BackendInterface::range_version_at(when);                        // no range version since the index was added
+    }
+    if(when <= 0) {
+        return -1;
+    }
+
+    size_t i = index.lower_bound(when);                                         // first version committed at or after when
+    if(i == 0) {
+        return -1;
+    }
+    return index.value(i - 1);
 }
 
 //##############################################################################
@@ -25,6 +25,7 @@
 #include "config_interface.h"
 #include "berkeley_dbcxx_env.h"
 #include "berkeley_dbcxx_db.h"
+#include "delta_feed.h"
 #include "../core/log.h"
 
 namespace range { namespace db {
@@ -48,10 +49,18 @@ class BerkeleyDB : public BackendInterface,
         virtual void set_wanted_version(uint64_t) override;
         virtual range_changelist_t get_changelist() override;
         virtual uint64_t get_graph_wanted_version(const std::string &graph_name) const override;
+        virtual uint64_t range_version_at(std::time_t when) override;
+        virtual read_snapshot_t read_snapshot() const override;
+        virtual subscription_t subscribe_deltas(const std::string &graph,
+                uint64_t from_version, delta_fn_t fn) override;
+        virtual bool catch_up_deltas(const std::string &graph) override;
         virtual void shutdown(bool terminal=false) override;
         static void backend_shutdown();
         std::string dbhome() const;
         void add_new_range_version();
+        bool convert_graph(const std::string &name);
+        virtual void begin_write_batch() override;
+        virtual void end_write_batch() override;
     private:
         BerkeleyDB(const boost::shared_ptr<db::ConfigIface> db_config);
         inline void init_info() const;
@@ -67,6 +76,7 @@ class BerkeleyDB : public BackendInterface,
         range::Emitter log;
         mutable std::unordered_set<std::string> graph_instances_;
         std::unordered_map<std::string, uint64_t> graph_wanted_version_map_;
+        DeltaFeed deltas_;
 
 
 };
@@ -0,0 +1,112 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _RANGE_DB_BERKELEY_DBCXX_BUFFER_H
+#define _RANGE_DB_BERKELEY_DBCXX_BUFFER_H
+
+#include <cstring>
+#include <memory>
+#include <string>
+
+#include <db_cxx.h>
+
+namespace range { namespace db {
+
+//##############################################################################
+/// Grow-on-demand buffer backing a DB_DBT_USERMEM Dbt. Readers keep one of
+/// these per thread (thread_local), so that reading a record reuses the same
+/// memory rather than allocating a fresh buffer every time.
+///
+/// @code{.cpp}
+///     Dbt &dbdata = buffer.dbt();
+///     do {
+///         dbrval = get_with_buffer_small_as_rval(&dbdata);
+///     } while(dbrval == DB_BUFFER_SMALL && buffer.grow());
+/// @endcode
+class BerkeleyDBCXXBuffer {
+    public:
+        static const size_t initial_size = 4096;
+        static const size_t max_retained_size = 262144;                         ///< larger buffers are released after use
+
+        //######################################################################
+        BerkeleyDBCXXBuffer() : buf_(new char[initial_size]), size_(initial_size), dbt_()
+        { }
+
+        //######################################################################
+        /// @return Dbt ready to receive a record into this buffer
+        Dbt& dbt() {
+            dbt_.set_data(buf_.get());
+            dbt_.set_size(0);
+            dbt_.set_ulen(size_);
+            dbt_.set_flags(DB_DBT_USERMEM);
+            return dbt_;
+        }
+
+        //######################################################################
+        /// @return Dbt holding a copy of key, which BerkeleyDB may overwrite
+        ///         with the key it finds (DB_SET_RANGE)
+        Dbt& dbt(const std::string &key) {
+            if(key.size() > size_) {
+                buf_.reset(new char[key.size()]);
+                size_ = key.size();
+            }
+            dbt();
+            std::memcpy(buf_.get(), key.data(), key.size());
+            dbt_.set_size(key.size());
+            return dbt_;
+        }
+
+        //######################################################################
+        /// Call after DB_BUFFER_SMALL; BerkeleyDB has left the required size
+        /// in the Dbt, so we grow exactly once to fit it.
+        ///
+        /// @return true if the buffer was grown and the read should be retried
+        bool grow() {
+            size_t wanted = dbt_.get_size();
+            if(wanted <= size_) {                                               // nothing to go on, double it
+                wanted = size_ * 2;
+            }
+            buf_.reset(new char[wanted]);
+            size_ = wanted;
+            dbt();
+            return true;
+        }
+
+        //######################################################################
+        /// Copy the record out of the buffer, and give back any memory we
+        /// grew to accommodate an unusually large record.
+        std::string str() {
+            std::string rval { static_cast<char *>(dbt_.get_data()), dbt_.get_size() };
+            if(size_ > max_retained_size) {
+                buf_.reset(new char[initial_size]);
+                size_ = initial_size;
+                dbt();
+            }
+            return rval;
+        }
+
+        //######################################################################
+        size_t capacity() const { return size_; }
+
+    private:
+        std::unique_ptr<char[]> buf_;
+        size_t size_;
+        Dbt dbt_;
+};
+
+} /* namespace db */ } /* namespace range */
+
+#endif
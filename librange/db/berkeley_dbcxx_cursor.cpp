@@ -18,20 +18,24 @@
 
 #include "berkeley_dbcxx_cursor.h"
 #include "db_exceptions.h"
-#include "pbuff_node.h"
+#include "head_node.h"
 #include "berkeley_dbcxx_db.h"
 
 namespace range { namespace db {
 
+thread_local BerkeleyDBCXXBuffer BerkeleyDBCXXCursor::key_buffer_;
+thread_local BerkeleyDBCXXBuffer BerkeleyDBCXXCursor::data_buffer_;
+
 static ::range::EmitterModuleRegistration BerkeleyDBCXXCursorLogModule { "db.BerkeleyDBCXXCursor" };
 //##############################################################################
 //##############################################################################
 BerkeleyDBCXXCursor::BerkeleyDBCXXCursor(
-        boost::shared_ptr<GraphInstanceInterface> inst,
+        boost::shared_ptr<BerkeleyDBCXXDb> inst,
         boost::shared_ptr<Db> db,
         boost::shared_ptr<BerkeleyDBCXXLock> lock
         )
-    : inst_(inst), db_(db), lock_(lock), 
+    : graph_(inst), inst_(boost::dynamic_pointer_cast<GraphInstanceInterface>(inst)),
+        db_(db), lock_(lock), 
         txn_(BerkeleyDBCXXLockTxnGetter(lock).txn()), log(BerkeleyDBCXXCursorLogModule)
 {
     int rval = 0;
@@ -76,47 +80,40 @@ bool
 BerkeleyDBCXXCursor::fetch_from_dbc(const std::string& fullkey, int flags,
         std::string &keybuf, std::string &databuf) const
 {
-    size_t localdatabuf_size = 131072;
-    size_t localkeybuf_size = 131072;
-    std::unique_ptr<char[]> localkeybuf { nullptr };
-    std::unique_ptr<char[]> localdatabuf { nullptr };
-    //char localkeybuf[131072] = { 0 };
-    //char localdatabuf[1048576] = { 0 };
-    
-    Dbt dbkey; 
-    Dbt dbdata;
+    Dbt setkey { (void *) fullkey.c_str(), (uint32_t) fullkey.size() };
+    bool key_out = fullkey.empty() || flags == DB_SET_RANGE;                   // then the key is an output, and goes in our buffer
+    Dbt *dbkey = key_out ? &key_buffer_.dbt() : &setkey;
+    Dbt *dbdata = &data_buffer_.dbt();
     int dbrval = 0;
 
     do { 
-        if(localdatabuf) { 
-            LOG(debug0, "resizing_record_buffer") << localdatabuf_size;
-        }
-        if(!fullkey.empty()) {
-            dbkey = Dbt( (void *) fullkey.c_str(), (uint32_t) fullkey.size());
-        } else { 
-            localkeybuf = std::unique_ptr<char[]>(new char[localkeybuf_size]);
-            dbkey = Dbt(localkeybuf.get(), localkeybuf_size);
-            dbkey.set_ulen(localkeybuf_size);
-            dbkey.set_flags(DB_DBT_USERMEM);
-            localkeybuf_size *= 2;
+        if(flags == DB_SET_RANGE) {
+            dbkey = &key_buffer_.dbt(fullkey);
         }
-
-        localdatabuf = std::unique_ptr<char[]>(new char[localdatabuf_size]);
-        dbdata = Dbt(localdatabuf.get(), localdatabuf_size);
-        dbdata.set_ulen(localdatabuf_size);
-        dbdata.set_flags(DB_DBT_USERMEM);
-        localdatabuf_size *= 2;
-
         try {
-            dbrval = cur_->get(&dbkey, &dbdata, flags);
+            dbrval = cur_->get(dbkey, dbdata, flags);
         }
         catch (DbException &e) {
-            if(e.get_errno() == DB_BUFFER_SMALL) { continue; }
-            THROW_STACK(CursorException(e.what()));
+            if(e.get_errno() != DB_BUFFER_SMALL) {
+                THROW_STACK(CursorException(e.what()));
+            }
+            dbrval = DB_BUFFER_SMALL;
         }
         catch (std::exception &e) {
             THROW_STACK(CursorException(e.what()));
         }
+        if(dbrval == DB_BUFFER_SMALL) {
+            bool grown = false;
+            if(key_out && dbkey->get_size() > key_buffer_.capacity()) {
+                LOG(debug0, "resizing_key_buffer") << dbkey->get_size();
+                grown = key_buffer_.grow();
+            }
+            if(dbdata->get_size() > data_buffer_.capacity()) {
+                LOG(debug0, "resizing_record_buffer") << dbdata->get_size();
+                grown = data_buffer_.grow();
+            }
+            if(!grown) { break; }
+        }
     } while(dbrval == DB_BUFFER_SMALL);
 
     switch(dbrval) {
@@ -141,11 +138,29 @@ BerkeleyDBCXXCursor::fetch_from_dbc(const std::string& fullkey, int flags,
             break;
     }
 
-    keybuf = std::string((char *) dbkey.get_data(), dbkey.get_size());
-    databuf = std::string((char *) dbdata.get_data(), dbdata.get_size());
+    if(key_out) {
+        keybuf = key_buffer_.str();
+    } else {
+        keybuf = fullkey;
+    }
+    databuf = data_buffer_.str();
     return true;
 }
 
+//##############################################################################
+// The node gets the record we just read, so that it doesn't have to read it
+// again; unless this thread has uncommitted changes to it, which our cursor
+// can't see.
+//##############################################################################
+BerkeleyDBCXXCursor::node_t
+BerkeleyDBCXXCursor::make_node(const std::string &name, std::string &databuf) const
+{
+    if(graph_->pending_record(record_type::NODE, name)) {
+        return boost::make_shared<HeadNode>(name, inst_);
+    }
+    return boost::make_shared<HeadNode>(name, inst_, std::move(databuf));
+}
+
 //##############################################################################
 //##############################################################################
 BerkeleyDBCXXCursor::node_t
@@ -153,10 +168,9 @@ BerkeleyDBCXXCursor::fetch(const std::string &name) const
 {
     std::string data;
     std::string key;
-    std::string fullkey = BerkeleyDBCXXDb::key_name(record_type::NODE, name);
+    std::string fullkey = graph_->db_key(record_type::NODE, name);
     if(this->fetch_from_dbc(fullkey, DB_SET, key, data)) {
-        auto n = boost::make_shared<ProtobufNode>(name, inst_);
-        return n;
+        return this->make_node(name, data);
     }
     return nullptr;
 }
@@ -169,9 +183,11 @@ BerkeleyDBCXXCursor::next() const
     std::string key;
     std::string data;
     while(this->fetch_from_dbc("", DB_NEXT, key, data)) {
-        if(BerkeleyDBCXXDb::get_type_from_keyname(key) == record_type::NODE) {
-            auto n = boost::make_shared<ProtobufNode>(BerkeleyDBCXXDb::unprefix(key), inst_);
-            return n;
+        if(graph_->db_key_type(key) == record_type::NODE) {
+            return this->make_node(graph_->db_key_unprefix(key), data);
+        }
+        if(graph_->ordered()) {                                                 // NODE sorts first; we're past the last one
+            break;
         }
     }
     return nullptr;
@@ -194,9 +210,11 @@ BerkeleyDBCXXCursor::prev() const
     std::string key;
     std::string data;
     while(this->fetch_from_dbc("", DB_PREV, key, data)) {
-        if(BerkeleyDBCXXDb::get_type_from_keyname(key) == record_type::NODE) {
-            auto n = boost::make_shared<ProtobufNode>(BerkeleyDBCXXDb::unprefix(key), inst_);
-            return n;
+        if(graph_->db_key_type(key) == record_type::NODE) {
+            return this->make_node(graph_->db_key_unprefix(key), data);
+        }
+        if(graph_->ordered()) {                                                 // above the nodes (nothing sorts below them)
+            return this->last();
         }
     }
     return nullptr;
@@ -218,10 +236,16 @@ BerkeleyDBCXXCursor::first() const
 {
     std::string key;
     std::string data;
+    if(graph_->ordered()) {
+        if(this->fetch_from_dbc(graph_->db_key_prefix(record_type::NODE), DB_SET_RANGE, key, data)
+                && graph_->db_key_type(key) == record_type::NODE) {
+            return this->make_node(graph_->db_key_unprefix(key), data);
+        }
+        return nullptr;
+    }
     if(this->fetch_from_dbc("", DB_FIRST, key, data)) {
-        if(BerkeleyDBCXXDb::get_type_from_keyname(key) == record_type::NODE) {
-            auto n = boost::make_shared<ProtobufNode>(BerkeleyDBCXXDb::unprefix(key), inst_);
-            return n;
+        if(graph_->db_key_type(key) == record_type::NODE) {
+            return this->make_node(graph_->db_key_unprefix(key), data);
         } else {
             return this->next();
         }
@@ -236,10 +260,19 @@ BerkeleyDBCXXCursor::last() const
 {
     std::string key;
     std::string data;
+    if(graph_->ordered()) {                                                     // step back from the first key after the nodes
+        auto after = graph_->db_key_prefix(record_type::GRAPH_META);
+        bool found = this->fetch_from_dbc(after, DB_SET_RANGE, key, data)
+            ? this->fetch_from_dbc("", DB_PREV, key, data)
+            : this->fetch_from_dbc("", DB_LAST, key, data);
+        if(found && graph_->db_key_type(key) == record_type::NODE) {
+            return this->make_node(graph_->db_key_unprefix(key), data);
+        }
+        return nullptr;
+    }
     if(this->fetch_from_dbc("", DB_LAST, key, data)) {
-        if(BerkeleyDBCXXDb::get_type_from_keyname(key) == record_type::NODE) {
-            auto n = boost::make_shared<ProtobufNode>(BerkeleyDBCXXDb::unprefix(key), inst_);
-            return n;
+        if(graph_->db_key_type(key) == record_type::NODE) {
+            return this->make_node(graph_->db_key_unprefix(key), data);
         } else {
             return this->prev();
         }
@@ -248,6 +281,65 @@ BerkeleyDBCXXCursor::last() const
 }
 
 
+//##############################################################################
+//##############################################################################
+bool
+BerkeleyDBCXXCursor::ordered() const
+{
+    return graph_->ordered();
+}
+
+//##############################################################################
+// On an ordered instance, nodes are keyed by name after a one byte type
+// prefix, so DB_SET_RANGE lands on the node we want.
+//##############################################################################
+BerkeleyDBCXXCursor::node_t
+BerkeleyDBCXXCursor::seek(const std::string &name) const
+{
+    if(!graph_->ordered()) {
+        return GraphCursorInterface::seek(name);
+    }
+    std::string key;
+    std::string data;
+    if(this->fetch_from_dbc(graph_->db_key(record_type::NODE, name), DB_SET_RANGE, key, data)
+            && graph_->db_key_type(key) == record_type::NODE) {
+        return this->make_node(graph_->db_key_unprefix(key), data);
+    }
+    return nullptr;
+}
+
+//##############################################################################
+// A hash instance has no key order to seek into, so every record is walked and
+// the ones that don't match are skipped.
+//##############################################################################
+void
+BerkeleyDBCXXCursor::scan(record_type type, const std::string &prefix,
+        std::function<bool(const std::string&, const std::string&)> fn) const
+{
+    std::string start = graph_->db_key(type, prefix);
+    if(!graph_->ordered()) {
+        std::string key;
+        std::string data;
+        bool found = this->fetch_from_dbc("", DB_FIRST, key, data);
+        while(found) {
+            if(key.compare(0, start.size(), start) == 0
+                    && !fn(graph_->db_key_unprefix(key), data)) {
+                return;
+            }
+            found = this->fetch_from_dbc("", DB_NEXT, key, data);
+        }
+        return;
+    }
+    std::string key;
+    std::string data;
+    bool found = this->fetch_from_dbc(start, DB_SET_RANGE, key, data);
+    while(found && key.compare(0, start.size(), start) == 0) {
+        if(!fn(graph_->db_key_unprefix(key), data)) {
+            return;
+        }
+        found = this->fetch_from_dbc("", DB_NEXT, key, data);
+    }
+}
 
 
 
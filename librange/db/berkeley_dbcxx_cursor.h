@@ -17,21 +17,24 @@
 #ifndef _RANGEXX_DB_BERKELEY_DBCXX_CURSOR_H
 #define _RANGEXX_DB_BERKELEY_DBCXX_CURSOR_H
 
+#include <functional>
 #include <db_cxx.h>
 #include "../core/log.h"
 
 #include "db_interface.h"
 #include "berkeley_dbcxx_lock.h"
 #include "berkeley_db_types.h"
+#include "berkeley_dbcxx_buffer.h"
 
 
 namespace range { namespace db {
 class BerkeleyDB;
+class BerkeleyDBCXXDb;
 
 class BerkeleyDBCXXCursor : public graph::GraphCursorInterface {
     public:
         //######################################################################
-        BerkeleyDBCXXCursor(boost::shared_ptr<GraphInstanceInterface> inst,
+        BerkeleyDBCXXCursor(boost::shared_ptr<BerkeleyDBCXXDb> inst,
                 boost::shared_ptr<Db> db,
                 boost::shared_ptr<BerkeleyDBCXXLock> lock);
 
@@ -52,15 +55,30 @@ class BerkeleyDBCXXCursor : public graph::GraphCursorInterface {
         virtual node_t first() const override;
         //######################################################################
         virtual node_t last() const override;
+        //######################################################################
+        virtual bool ordered() const override;
+        //######################################################################
+        virtual node_t seek(const std::string& name) const override;
+        //######################################################################
+        /// Call fn with the name and data of each record of type whose name
+        /// starts with prefix until it returns false; in name order on an
+        /// ordered instance, a full walk in no particular order otherwise
+        void scan(record_type type, const std::string &prefix,
+                std::function<bool(const std::string&, const std::string&)> fn) const;
     protected:
         bool fetch_from_dbc(const std::string &fullkey, int flags, std::string &keybuf, std::string &databuf) const;
+        node_t make_node(const std::string &name, std::string &databuf) const;
     private:
+        boost::shared_ptr<BerkeleyDBCXXDb> graph_;
         mutable boost::shared_ptr<GraphInstanceInterface> inst_;
         boost::shared_ptr<Db> db_;
         boost::shared_ptr<BerkeleyDBCXXLock> lock_;
         DbTxn * txn_;
         Dbc * cur_;
         range::Emitter log;
+
+        thread_local static BerkeleyDBCXXBuffer key_buffer_;                   // reused by every cursor read on this thread
+        thread_local static BerkeleyDBCXXBuffer data_buffer_;
 };
 
 
@@ -15,17 +15,24 @@
  * along with range++.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstdio>
+#include <cstdlib>
+#include <set>
+#include <sstream>
+
 #include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include "berkeley_dbcxx_db.h"
 #include "berkeley_dbcxx_txn.h"
 #include "berkeley_dbcxx_cursor.h"
+#include "packed_version_index.h"
 
 namespace range { namespace db {
 
 thread_local std::unordered_map<std::string, boost::shared_ptr<BerkeleyDBCXXDb>> BerkeleyDBCXXDb::multiton_map_;
 thread_local bool BerkeleyDBCXXDb::thread_registered_ = false;
+thread_local BerkeleyDBCXXBuffer BerkeleyDBCXXDb::read_buffer_;
 
 //##############################################################################
 //##############################################################################
@@ -64,10 +71,16 @@ static ::range::EmitterModuleRegistration BerkeleyDBCXXDbLogModule { "db.Berkele
 BerkeleyDBCXXDb::BerkeleyDBCXXDb(const std::string &name,
         boost::shared_ptr<BerkeleyDB> backend,
         const boost::shared_ptr<db::ConfigIface> db_config, boost::shared_ptr<BerkeleyDBCXXEnv> env)
-    : name_(name), backend_(backend), env_(env), db_config_(db_config), log(BerkeleyDBCXXDbLogModule)
+    : node_encoding_(-1), name_(name), backend_(backend), env_(env), db_config_(db_config),
+    log(BerkeleyDBCXXDbLogModule)
 {
     RANGE_LOG_FUNCTION();
     inst_ = boost::make_shared<Db>(env_->getEnv(), 0);
+    access_method_ = existing_access_method(name);
+    if(access_method_ == DB_UNKNOWN) {
+        access_method_ = (db_config_->graph_access_method() == ConfigIface::access_method::BTREE)
+            ? DB_BTREE : DB_HASH;
+    }
 
     int rval = 0;
     DbTxn * txn;
@@ -78,7 +91,7 @@ BerkeleyDBCXXDb::BerkeleyDBCXXDb(const std::string &name,
         THROW_STACK(UnknownTransactionException(e.what()));
     }
     try { 
-        inst_->open(txn, name.c_str(), name.c_str(), DB_HASH,
+        inst_->open(txn, name.c_str(), name.c_str(), access_method_,
                 DB_CREATE | DB_MULTIVERSION | DB_THREAD, 0);
     }
     catch(DbException &e) {
@@ -98,6 +111,114 @@ BerkeleyDBCXXDb::BerkeleyDBCXXDb(const std::string &name,
     txn->commit(0);
 }
 
+//##############################################################################
+// A database keeps the layout it was created with, whatever the config now
+// says; DB_UNKNOWN if it doesn't exist yet.
+//##############################################################################
+DBTYPE
+BerkeleyDBCXXDb::existing_access_method(const std::string &name) const
+{
+    RANGE_LOG_FUNCTION();
+    DBTYPE type = DB_UNKNOWN;
+    Db probe { env_->getEnv(), DB_CXX_NO_EXCEPTIONS };
+    if(probe.open(NULL, name.c_str(), name.c_str(), DB_UNKNOWN, DB_RDONLY, 0) == 0) {
+        probe.get_type(&type);
+    }
+    probe.close(0);
+    return type;
+}
+
+//##############################################################################
+// The copy is made outside any transaction, into a file of its own, so that
+// a graph of any size doesn't have to fit in the lock table; only swapping it
+// in for the original is transactional. A copy left by an interrupted run is
+// discarded and made again.
+//##############################################################################
+bool
+BerkeleyDBCXXDb::convert(const std::string &name, DBTYPE access_method,
+        boost::shared_ptr<BerkeleyDBCXXEnv> env)
+{
+    BOOST_LOG_FUNCTION();
+    ::range::Emitter log { BerkeleyDBCXXDbLogModule };
+    DbEnv * dbenv = env->getEnv();
+    std::string copy_name = name + ".convert";
+
+    Db from { dbenv, DB_CXX_NO_EXCEPTIONS };
+    DBTYPE from_method = DB_UNKNOWN;
+    if(from.open(NULL, name.c_str(), name.c_str(), DB_UNKNOWN, DB_RDONLY, 0) == 0) {
+        from.get_type(&from_method);
+    }
+    if(from_method == DB_UNKNOWN || from_method == access_method) {
+        from.close(0);
+        return false;
+    }
+
+    auto db_key = [](DBTYPE method, record_type type, const std::string &key) {
+        return (method == DB_BTREE) ? std::string(1, static_cast<char>(type)) + key
+            : key_name(type, key);
+    };
+
+    try {
+        dbenv->dbremove(NULL, copy_name.c_str(), NULL, DB_AUTO_COMMIT);
+    }
+    catch(DbException &e) {
+        if(e.get_errno() != ENOENT) {
+            from.close(0);
+            THROW_STACK(DatabaseEnvironmentException(e.what()));
+        }
+    }
+
+    Dbc * cur = nullptr;
+    Dbt key, data;
+    key.set_flags(DB_DBT_REALLOC);
+    data.set_flags(DB_DBT_REALLOC);
+    size_t records = 0;
+    std::string error;
+    try {
+        Db into { dbenv, 0 };
+        into.open(NULL, copy_name.c_str(), name.c_str(), access_method, DB_CREATE | DB_EXCL, 0);
+        int rval = from.cursor(NULL, &cur, 0);
+        while(rval == 0 && (rval = cur->get(&key, &data, DB_NEXT)) == 0) {
+            std::string dbkey { static_cast<char*>(key.get_data()), key.get_size() };
+            std::string newkey = (from_method == DB_BTREE)
+                ? db_key(access_method, record_type(static_cast<uint8_t>(dbkey[0])), dbkey.substr(1))
+                : db_key(access_method, get_type_from_keyname(dbkey), unprefix(dbkey));
+            Dbt intokey { (void*) newkey.c_str(), (uint32_t) newkey.size() };
+            Dbt intodata { data.get_data(), data.get_size() };
+            into.put(NULL, &intokey, &intodata, 0);
+            ++records;
+        }
+        if(rval != DB_NOTFOUND) {
+            error = std::string("reading ") + name + ": " + db_strerror(rval);
+        }
+        into.close(0);
+    }
+    catch(DbException &e) {
+        error = e.what();
+    }
+    if(cur) { cur->close(); }
+    from.close(0);
+    free(key.get_data());
+    free(data.get_data());
+    if(!error.empty()) {
+        THROW_STACK(DatabaseEnvironmentException(error));
+    }
+
+    DbTxn * txn = nullptr;
+    try {
+        dbenv->txn_begin(NULL, &txn, DB_TXN_SYNC);
+        dbenv->dbremove(txn, name.c_str(), NULL, 0);
+        dbenv->dbrename(txn, copy_name.c_str(), NULL, name.c_str(), 0);
+        txn->commit(0);
+    }
+    catch(DbException &e) {
+        if(txn) { txn->abort(); }
+        THROW_STACK(DatabaseEnvironmentException(e.what()));
+    }
+    LOG(info, "converted_graph") << name << ": " << records << " records";
+    return true;
+}
+
 //##############################################################################
 //##############################################################################
 BerkeleyDBCXXDb::~BerkeleyDBCXXDb() noexcept
@@ -162,7 +283,7 @@ BerkeleyDBCXXDb::get_cursor() const
             );
     auto lck = env_->acquire_DbTxn_lock(false);
     auto c = boost::make_shared<BerkeleyDBCXXCursor>(
-            boost::dynamic_pointer_cast<GraphInstanceInterface>(mutable_self),
+            mutable_self,
             inst_, 
             lck);
     return boost::dynamic_pointer_cast<range::graph::GraphCursorInterface>(c);
@@ -173,7 +294,7 @@ std::string
 BerkeleyDBCXXDb::get_record(record_type type, const std::string& key) const
 {
     RANGE_LOG_TIMED_FUNCTION();
-    std::string fullkey = key_name(type, key);
+    std::string fullkey = db_key(type, key);
     auto txn = current_txn_.lock();
     if(txn) {
         std::string data;
@@ -185,38 +306,25 @@ BerkeleyDBCXXDb::get_record(record_type type, const std::string& key) const
     DbTxn * dbtxn = BerkeleyDBCXXLockTxnGetter(lck).txn();
     Dbt dbkey { (void*) fullkey.c_str(), (uint32_t) fullkey.size() };
 
-    size_t bufsize = 131072;
-    std::unique_ptr<char[]> buf { nullptr };
-    Dbt dbdata;
+    Dbt &dbdata = read_buffer_.dbt();
+    int flags = lck->readonly() ? 0 : DB_RMW;
     int dbrval = 0;
-  
-    do {
-        if(buf) { LOG(debug0, "resizing_record_buffer") << bufsize; }
-        buf = std::unique_ptr<char[]>(new char[bufsize]);
-
-        if(!buf) {
-            std::stringstream s;
-            s << "Unable to allocate buffer of size: " << bufsize;
-            THROW_STACK(DatabaseEnvironmentException(s.str()));
-        }
-
-        dbdata = Dbt(buf.get(), bufsize);
-        dbdata.set_ulen(bufsize);
-        dbdata.set_flags(DB_DBT_USERMEM);
-        bufsize *= 2;
 
-        int flags = lck->readonly() ? 0 : DB_RMW;
+    do {
         try {
             dbrval = inst_->get(dbtxn, &dbkey, &dbdata, flags);
         }
         catch (DbException &e) {
-            if(e.get_errno() == DB_BUFFER_SMALL) { continue; }
-            THROW_STACK(DatabaseEnvironmentException(std::string("Unable to read record") + e.what()));
+            if(e.get_errno() != DB_BUFFER_SMALL) {
+                THROW_STACK(DatabaseEnvironmentException(std::string("Unable to read record") + e.what()));
+            }
+            dbrval = DB_BUFFER_SMALL;
         }
         catch (std::exception &e) {
             THROW_STACK(DatabaseEnvironmentException(std::string("Unable to read record") + e.what()));
         }
-    } while(dbrval == DB_BUFFER_SMALL);
+        if(dbrval == DB_BUFFER_SMALL) { LOG(debug0, "resizing_record_buffer") << dbdata.get_size(); }
+    } while(dbrval == DB_BUFFER_SMALL && read_buffer_.grow());
 
     switch(dbrval) {
         case 0:
@@ -239,8 +347,17 @@ BerkeleyDBCXXDb::get_record(record_type type, const std::string& key) const
             LOG(error, "unknown dbrval") << dbrval;
     }
 
-    std::string rval { (char *) dbdata.get_data(), dbdata.get_size() };
-    return rval;
+    return read_buffer_.str();
+}
+
+//##############################################################################
+//##############################################################################
+bool
+BerkeleyDBCXXDb::pending_record(record_type type, const std::string& key) const
+{
+    auto txn = current_txn_.lock();
+    std::string data;
+    return txn && txn->get_record(type, key, data);
 }
 
 //##############################################################################
@@ -254,7 +371,7 @@ BerkeleyDBCXXDb::commit_record(change_t change)
     uint64_t object_version;
 
     std::tie(type, key, object_version, data) = change;
-    std::string fullkey = key_name(type, key);
+    std::string fullkey = db_key(type, key);
 
     auto lck = boost::dynamic_pointer_cast<BerkeleyDBCXXLock>(this->write_lock(type, key));
     DbTxn * dbtxn = BerkeleyDBCXXLockTxnGetter(lck).txn();
@@ -293,16 +410,91 @@ BerkeleyDBCXXDb::commit_record(change_t change)
     }
 }
 
+//##############################################################################
+//##############################################################################
+bool
+BerkeleyDBCXXDb::delete_record(record_type type, const std::string &key)
+{
+    RANGE_LOG_TIMED_FUNCTION();
+    std::string fullkey = db_key(type, key);
+
+    auto lck = boost::dynamic_pointer_cast<BerkeleyDBCXXLock>(this->write_lock(type, key));
+    DbTxn * dbtxn = BerkeleyDBCXXLockTxnGetter(lck).txn();
+    Dbt dbkey { (void*) fullkey.c_str(), (uint32_t) fullkey.size() };
+
+    int dbrval = 0;
+    try {
+        dbrval = inst_->del(dbtxn, &dbkey, 0);
+    }
+    catch (DbException &e) {
+        if(e.get_errno() != DB_NOTFOUND) {
+            THROW_STACK(DatabaseEnvironmentException(std::string("Unable to delete record") + e.what()));
+        }
+        dbrval = DB_NOTFOUND;
+    }
+    catch (std::exception &e) {
+        THROW_STACK(DatabaseEnvironmentException(std::string("Unable to delete record") + e.what()));
+    }
+    switch(dbrval) {
+        case 0:
+        case DB_NOTFOUND:
+            return true;
+            break;
+        case DB_LOCK_DEADLOCK:
+            THROW_STACK(DatabaseEnvironmentException("A transactional database environment operation was selected to resolve a deadlock."));
+            break;
+        case DB_LOCK_NOTGRANTED:
+            THROW_STACK(DatabaseEnvironmentException("unable to grant a lock in the allowed time."));
+            break;
+        case EACCES:
+            THROW_STACK(DatabaseEnvironmentException("Database read-only"));
+            break;
+        default:
+            LOG(error, "unknown_rval_from_Db_del") << dbrval;
+            return false;
+    }
+}
+
 //##############################################################################
 //##############################################################################
 bool
 BerkeleyDBCXXDb::write_record(record_type type, const std::string &key, uint64_t object_version, const std::string &data)
 {
     RANGE_LOG_FUNCTION();
+    if(type == record_type::GRAPH_META && key == "node_encoding") {
+        node_encoding_ = -1;
+    }
     auto txn = boost::dynamic_pointer_cast<BerkeleyDBCXXTxn>(this->start_txn());
     return txn->add_change(std::make_tuple(type, key, object_version, data));
 }
 
+//##############################################################################
+// Found first, then deleted when the transaction commits: an empty change
+// deletes its record (see BerkeleyDBCXXTxn::commit)
+//##############################################################################
+size_t
+BerkeleyDBCXXDb::remove_records(record_type type, const std::string &prefix)
+{
+    RANGE_LOG_TIMED_FUNCTION() << prefix;
+    auto lock = this->write_lock(type, prefix);
+    auto txn = boost::dynamic_pointer_cast<BerkeleyDBCXXTxn>(this->start_txn());
+    std::set<std::string> keys;
+    for (auto &key : txn->pending_keys(type, prefix)) {                         // not committed yet, but would be
+        keys.insert(key);
+    }
+    {
+        auto cur = boost::dynamic_pointer_cast<BerkeleyDBCXXCursor>(this->get_cursor());
+        cur->scan(type, prefix, [&keys](const std::string &key, const std::string &) {
+                keys.insert(key);
+                return true;
+            });
+    }
+    for (auto &key : keys) {
+        txn->add_change(std::make_tuple(type, key, 0, std::string()));
+    }
+    return keys.size();
+}
+
 //##############################################################################
 //##############################################################################
 ChangeList
@@ -326,14 +518,151 @@ BerkeleyDBCXXDb::read_changelist() const
 }
 
 
+//##############################################################################
+// Each version's changes live in their own GRAPH_META record, so that a commit
+// only writes what it changed. Zero-padded so the keys sort by version.
+//##############################################################################
+std::string
+BerkeleyDBCXXDb::changelist_key(uint64_t version)
+{
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "changelist\a%020llu", static_cast<unsigned long long>(version));
+    return std::string(buf);
+}
+
+//##############################################################################
+//##############################################################################
+bool
+BerkeleyDBCXXDb::read_change(uint64_t version, ChangeList_Change &change) const
+{
+    RANGE_LOG_FUNCTION();
+    std::string buf = this->get_record(record_type::GRAPH_META, changelist_key(version));
+    if(buf.empty()) {
+        return false;
+    }
+    change.ParseFromString(buf);
+    if(!change.IsInitialized()) {
+        THROW_STACK(DatabaseVersioningError("Change cannot be initialized"));
+    }
+    return true;
+}
+
+//##############################################################################
+// Graphs written before the changelist was split up keep their whole history
+// in the single "changelist" record. Split it into per-version records, and
+// leave only the current_version behind. Once the "version" record exists
+// there is nothing to do. MUST HOLD a write lock.
+//##############################################################################
+bool
+BerkeleyDBCXXDb::migrate_changelist()
+{
+    RANGE_LOG_FUNCTION();
+    if(!this->get_record(record_type::GRAPH_META, "version").empty()) {
+        return false;
+    }
+
+    ChangeList changes = this->read_changelist();
+    if(changes.current_version() == 0 && changes.change_size() == 0) {
+        return false;
+    }
+    if(static_cast<uint64_t>(changes.change_size()) != changes.current_version()) {
+        std::stringstream s;
+        s << "changelist inconsistent with graph version, found: "
+            << changes.change_size() << ", expected " << changes.current_version();
+        THROW_STACK(DatabaseVersioningError(s.str()));
+    }
+
+    LOG(notice, "migrating_changelist") << name_ << " at version " << changes.current_version();
+    for (int v = 0; v < changes.change_size(); ++v) {
+        this->commit_record(std::make_tuple(record_type::GRAPH_META, changelist_key(v + 1), 0,
+                    changes.change(v).SerializeAsString()));
+    }
+    this->commit_record(std::make_tuple(record_type::GRAPH_META, "version", 0,
+                std::to_string(static_cast<unsigned long long>(changes.current_version()))));
+
+    changes.clear_change();
+    this->commit_record(std::make_tuple(record_type::GRAPH_META, "changelist", 0, changes.SerializeAsString()));
+    return true;
+}
+
+//##############################################################################
+//##############################################################################
+std::string
+BerkeleyDBCXXDb::node_history_key(const std::string &name)
+{
+    return "node_history\a" + name;
+}
+
+//##############################################################################
+// Each node has a GRAPH_META record of (graph version, object version) pairs,
+// one for every graph version that wrote it; "node_history_version" is the
+// graph version through which they are complete. Graphs with history from
+// before that are backfilled here, once. MUST HOLD a write lock.
+//##############################################################################
+bool
+BerkeleyDBCXXDb::add_node_history(uint64_t version, const ChangeList_Change &change)
+{
+    RANGE_LOG_FUNCTION();
+    std::string buf = this->get_record(record_type::GRAPH_META, "node_history_version");
+    uint64_t indexed = buf.empty() ? 0 : std::strtoull(buf.c_str(), nullptr, 10);
+    if(indexed >= version) {
+        return false;
+    }
+
+    std::unordered_map<std::string, PackedVersionIndex> histories;
+    auto add = [&](uint64_t v, const ChangeList_Change &c) {
+        for (int i = 0; i < c.items_size(); ++i) {
+            std::string name = unprefix(c.items(i).key());
+            auto it = histories.find(name);
+            if(it == histories.end()) {
+                it = histories.emplace(name, PackedVersionIndex(
+                            this->get_record(record_type::GRAPH_META, node_history_key(name)))).first;
+            }
+            it->second.append(v, c.items(i).version());
+        }
+    };
+
+    if(indexed + 1 < version) {
+        LOG(notice, "rebuilding_node_history") << name_ << " versions " << indexed + 1 << " through " << version - 1;
+        ChangeList_Change prior;
+        for (uint64_t v = indexed + 1; v < version; ++v) {
+            if(!this->read_change(v, prior)) {
+                std::stringstream s;
+                s << "changelist missing for version " << v;
+                THROW_STACK(DatabaseVersioningError(s.str()));
+            }
+            add(v, prior);
+        }
+    }
+    add(version, change);
+
+    for (auto &h : histories) {
+        this->commit_record(std::make_tuple(record_type::GRAPH_META, node_history_key(h.first), 0, h.second.str()));
+    }
+    return this->commit_record(std::make_tuple(record_type::GRAPH_META, "node_history_version", 0,
+                std::to_string(static_cast<unsigned long long>(version))));
+}
+
+//##############################################################################
+//##############################################################################
+uint64_t
+BerkeleyDBCXXDb::committed_version() const
+{
+    RANGE_LOG_FUNCTION();
+    std::string buf = this->get_record(record_type::GRAPH_META, "version");
+    if(!buf.empty()) {
+        return std::strtoull(buf.c_str(), nullptr, 10);
+    }
+    return this->read_changelist().current_version();                           // not migrated yet
+}
+
 //##############################################################################
 //##############################################################################
 uint64_t
 BerkeleyDBCXXDb::version() const
 {
     RANGE_LOG_FUNCTION();
-    ChangeList changes = this->read_changelist();
-    uint64_t version = changes.current_version();
+    uint64_t version = this->committed_version();
     auto txn = current_txn_.lock();
     if(txn && txn->pending() > 0) {
         ++version;
@@ -383,31 +712,149 @@ BerkeleyDBCXXDb::n_redges() const
     return 0;
 }
 
+//##############################################################################
+//##############################################################################
+BerkeleyDBCXXDb::changelist_t
+BerkeleyDBCXXDb::change_to_changelist(const ChangeList_Change &v_change)
+{
+    changelist_t clist;
+    for (int i = 0; i < v_change.items_size(); ++i) {
+        const ChangeList_Change_Item &item = v_change.items(i);
+        record_type type = get_type_from_keyname(item.key());
+        std::string key = item.key().substr(key_prefix(type).size());
+        clist.push_back(std::make_tuple(type, key, item.version(), ""));
+    }
+    return clist;
+}
+
 //##############################################################################
 //##############################################################################
 BerkeleyDBCXXDb::history_list_t
 BerkeleyDBCXXDb::get_change_history() const
 {
     RANGE_LOG_FUNCTION();
-    ChangeList changes = this->read_changelist();
     history_list_t history_list;
 
-    for (int v = 0; v < changes.change_size(); ++v) {
-        ChangeList_Change v_change = changes.change(v);
-        changelist_t clist;
-
-        for (int i = 0; i < v_change.items_size(); ++i) {
-            ChangeList_Change_Item item = v_change.items(i);
-            record_type type = get_type_from_keyname(item.key());
-            std::string key = item.key().substr(key_prefix(type).size());
-            clist.push_back(std::make_tuple(type, key, item.version(), ""));
+    if(this->get_record(record_type::GRAPH_META, "version").empty()) {         // not migrated yet
+        ChangeList changes = this->read_changelist();
+        for (int v = 0; v < changes.change_size(); ++v) {
+            history_list.push_back(change_to_changelist(changes.change(v)));
         }
-        history_list.push_back(clist);
+        return history_list;
+    }
+
+    uint64_t current = this->committed_version();
+    ChangeList_Change v_change;
+    if(this->ordered()) {                                                       // one pass over the contiguous, sorted keys
+        auto cursor = boost::dynamic_pointer_cast<BerkeleyDBCXXCursor>(this->get_cursor());
+        cursor->scan(record_type::GRAPH_META, "changelist\a", [&](const std::string &key, const std::string &data) {
+                    if(history_list.size() >= current || key != changelist_key(history_list.size() + 1)) {
+                        return false;
+                    }
+                    v_change.ParseFromString(data);
+                    if(!v_change.IsInitialized()) {
+                        THROW_STACK(DatabaseVersioningError("Change cannot be initialized"));
+                    }
+                    history_list.push_back(change_to_changelist(v_change));
+                    return true;
+                });
+    }
+    for (uint64_t v = history_list.size() + 1; v <= current; ++v) {             // this transaction's, or unordered
+        if(!this->read_change(v, v_change)) {
+            std::stringstream s;
+            s << "changelist missing for version " << v << " of " << current;
+            THROW_STACK(DatabaseVersioningError(s.str()));
+        }
+        history_list.push_back(change_to_changelist(v_change));
     }
 
     return history_list;
 }
 
+//##############################################################################
+//##############################################################################
+bool
+BerkeleyDBCXXDb::get_change(uint64_t version, changelist_t &change) const
+{
+    RANGE_LOG_FUNCTION();
+    if(this->get_record(record_type::GRAPH_META, "version").empty()) {         // not migrated yet
+        return GraphInstanceInterface::get_change(version, change);
+    }
+    ChangeList_Change v_change;
+    if(!this->read_change(version, v_change)) {
+        return false;
+    }
+    change = change_to_changelist(v_change);
+    return true;
+}
+
+//##############################################################################
+//##############################################################################
+uint64_t
+BerkeleyDBCXXDb::node_version_at(const std::string& name, uint64_t version) const
+{
+    RANGE_LOG_FUNCTION();
+    std::string buf = this->get_record(record_type::GRAPH_META, "node_history_version");
+    if(buf.empty() || std::strtoull(buf.c_str(), nullptr, 10) < version) {
+        return GraphInstanceInterface::node_version_at(name, version);         // not indexed (yet)
+    }
+
+    PackedVersionIndex history { this->get_record(record_type::GRAPH_META, node_history_key(name)) };
+    size_t i = history.lower_bound(version + 1);                                // first write after version
+    if(i == 0) {
+        return -1;
+    }
+    return history.value(i - 1);
+}
+
+//##############################################################################
+//##############################################################################
+std::string
+BerkeleyDBCXXDb::graph_name() const
+{
+    return name_;
+}
+
+//##############################################################################
+// Read once per (thread-local) instance; graphs are only converted with
+// stored stopped, by range_upgrade, which writes the record through us.
+//##############################################################################
+BerkeleyDBCXXDb::node_encoding
+BerkeleyDBCXXDb::node_record_encoding() const
+{
+    RANGE_LOG_FUNCTION();
+    if(node_encoding_ < 0) {
+        node_encoding_ = static_cast<int>((get_record(record_type::GRAPH_META, "node_encoding") == "sectioned")
+                ? node_encoding::SECTIONED : node_encoding::PROTOBUF);
+    }
+    return static_cast<node_encoding>(node_encoding_);
+}
+
+//##############################################################################
+//##############################################################################
+uint64_t
+BerkeleyDBCXXDb::cache_generation(record_type type, const std::string& key) const
+{
+    RANGE_LOG_FUNCTION();
+    if(type != record_type::NODE) {
+        return 0;
+    }
+    auto txn = current_txn_.lock();
+    if(txn && txn->pending() > 0) {                                             // we must see our own uncommitted writes
+        return 0;
+    }
+    auto lck = boost::dynamic_pointer_cast<BerkeleyDBCXXLock>(this->read_lock(type, key));
+    if(!lck || !lck->readonly()) {                                              // writers always go to the db
+        return 0;
+    }
+    uint64_t generation = lck->cache_generation(name_);
+    if(!generation) {                                                           // what's on disk, so writes from other
+        generation = this->committed_version() + 1;                             // processes are seen too
+        lck->set_cache_generation(name_, generation);
+    }
+    return generation;
+}
+
 //##############################################################################
 //##############################################################################
 std::string
@@ -456,6 +903,50 @@ BerkeleyDBCXXDb::unprefix(const std::string &fullkey)
     return fullkey.substr(key_prefix(type).length(), std::string::npos);
 }
 
+//##############################################################################
+// DB_HASH databases store records under key_name(); DB_BTREE ones under a
+// single byte of record type followed by the name, so that each type (and
+// each run of names with a common prefix) is one contiguous range of keys.
+//##############################################################################
+std::string
+BerkeleyDBCXXDb::db_key_prefix(record_type type) const
+{
+    if(access_method_ == DB_BTREE) {
+        return std::string(1, static_cast<char>(type));
+    }
+    return key_prefix(type);
+}
+
+//##############################################################################
+//##############################################################################
+std::string
+BerkeleyDBCXXDb::db_key(record_type type, const std::string &name) const
+{
+    return db_key_prefix(type) + name;
+}
+
+//##############################################################################
+//##############################################################################
+BerkeleyDBCXXDb::record_type
+BerkeleyDBCXXDb::db_key_type(const std::string &dbkey) const
+{
+    if(access_method_ == DB_BTREE) {
+        return dbkey.empty() ? record_type::UNKNOWN : record_type(static_cast<uint8_t>(dbkey[0]));
+    }
+    return get_type_from_keyname(dbkey);
+}
+
+//##############################################################################
+//##############################################################################
+std::string
+BerkeleyDBCXXDb::db_key_unprefix(const std::string &dbkey) const
+{
+    if(access_method_ == DB_BTREE) {
+        return dbkey.substr(1);
+    }
+    return unprefix(dbkey);
+}
+
 
 
 } /* namespace db */ } /* namespace range */
@@ -33,6 +33,7 @@
 #include "berkeley_dbcxx_env.h"
 #include "berkeley_dbcxx_txn.h"
 #include "berkeley_dbcxx_lock.h"
+#include "berkeley_dbcxx_buffer.h"
 
 namespace range { namespace db {
 class BerkeleyDB;
@@ -50,6 +51,16 @@ class BerkeleyDBCXXDb : public GraphInstanceInterface,
                 const boost::shared_ptr<db::ConfigIface> db_config,
                 boost::shared_ptr<BerkeleyDBCXXEnv> env);
         static void close_all_db() { multiton_map_.clear(); };
+        static void close_db(const std::string &name) { multiton_map_.erase(name); };
+
+        //######################################################################
+        /// Copy every record of graph database name into a new database of
+        /// access_method, and put that in place of the original. Nothing may
+        /// have name open.
+        ///
+        /// @return false if name already has that layout, or doesn't exist
+        static bool convert(const std::string &name, DBTYPE access_method,
+                boost::shared_ptr<BerkeleyDBCXXEnv> env);
 
         virtual size_t n_vertices() const override;
         virtual size_t n_edges() const override;
@@ -62,18 +73,42 @@ class BerkeleyDBCXXDb : public GraphInstanceInterface,
         virtual txn_t start_txn() override;
         virtual bool write_record(record_type type, const std::string& key,
                                 uint64_t object_version, const std::string& data) override;
+        virtual size_t remove_records(record_type type, const std::string& prefix) override;
         virtual history_list_t get_change_history() const override;
+        virtual bool get_change(uint64_t version, changelist_t &change) const override;
+        virtual uint64_t node_version_at(const std::string& name, uint64_t version) const override;
+        virtual std::string graph_name() const override;
+        virtual uint64_t cache_generation(record_type type, const std::string& key) const override;
+        virtual node_encoding node_record_encoding() const override;
 
         virtual ~BerkeleyDBCXXDb() noexcept override;
 
         bool commit_record(change_t);
+        bool delete_record(record_type type, const std::string& key);
+        bool pending_record(record_type type, const std::string& key) const;   ///< true if this thread's txn has uncommitted changes to it
         ChangeList read_changelist() const;
+        uint64_t committed_version() const;
+        bool read_change(uint64_t version, ChangeList_Change &change) const;
+        bool migrate_changelist();
+        bool add_node_history(uint64_t version, const ChangeList_Change &change);
+
+        static std::string changelist_key(uint64_t version);
+        static std::string node_history_key(const std::string &name);
 
         static std::string key_prefix(record_type type);
         static std::string key_name(record_type type, const std::string &name);
         static record_type get_type_from_keyname(const std::string &fullkey);
         static std::string unprefix(const std::string &fullkey);
+
+        bool ordered() const { return access_method_ == DB_BTREE; }            ///< keys are sorted, so DB_SET_RANGE finds prefixes
+        std::string db_key_prefix(record_type type) const;                     ///< the on-disk form of key_prefix() for this database
+        std::string db_key(record_type type, const std::string &name) const;
+        record_type db_key_type(const std::string &dbkey) const;
+        std::string db_key_unprefix(const std::string &dbkey) const;
     private:
+        static changelist_t change_to_changelist(const ChangeList_Change &change);
+        DBTYPE existing_access_method(const std::string &name) const;
+
         BerkeleyDBCXXDb(const std::string &name,
                 boost::shared_ptr<BerkeleyDB> backend, 
                 const boost::shared_ptr<db::ConfigIface> db_config,
@@ -81,6 +116,7 @@ class BerkeleyDBCXXDb : public GraphInstanceInterface,
 
         thread_local static std::unordered_map<std::string, boost::shared_ptr<BerkeleyDBCXXDb>> multiton_map_;
         thread_local static bool thread_registered_;
+        thread_local static BerkeleyDBCXXBuffer read_buffer_;                  // reused by every get_record on this thread
 
         // because instances of this db RAII class are thread-local (because they are created in this thread
         // if not found in the thread_local multiton map), any txn or db instance is held by this
@@ -88,6 +124,8 @@ class BerkeleyDBCXXDb : public GraphInstanceInterface,
         boost::weak_ptr<BerkeleyDBCXXTxn> current_txn_;
 
         boost::shared_ptr<Db> inst_;
+        DBTYPE access_method_;
+        mutable int node_encoding_;                                             ///< node_encoding from the GRAPH_META "node_encoding" record, or -1 until read
         std::string name_;
         boost::shared_ptr<BerkeleyDB> backend_;
         boost::shared_ptr<BerkeleyDBCXXEnv> env_;
@@ -20,6 +20,7 @@
 #include <fcntl.h>
 #include "berkeley_dbcxx_env.h"
 #include "berkeley_dbcxx_db.h"
+#include "node_info_cache.h"
 
 
 namespace range { namespace db {
@@ -54,12 +55,14 @@ BerkeleyDBCXXEnv::shutdown()
     BerkeleyDBCXXDb::close_all_db();                                            // close any open databases in this thread; since we are a singleton
     current_lock_.reset();
     inst_.reset();
+    NodeInfoCache::get()->clear();                                              // the next environment may be a different db_home
 }
 
 //##############################################################################
 //##############################################################################
 BerkeleyDBCXXEnv::BerkeleyDBCXXEnv(const boost::shared_ptr<db::ConfigIface> db_config)
-    : env_{0}, log{BerkeleyDBCXXEnvLogModule}
+    : env_{0}, log{BerkeleyDBCXXEnvLogModule},
+    group_commit_{&env_, db_config->write_durability(), db_config->group_commit_delay()}
 {
     RANGE_LOG_FUNCTION();
     int rval = 0;
@@ -287,11 +290,16 @@ BerkeleyDBCXXEnv::acquire_DbTxn_lock(bool readwrite)
     RANGE_LOG_FUNCTION();
     auto l = current_lock_.lock();                                              /* note this lock is weak_ptr's lock, not our lock */
     if(!l) {
-        l = boost::make_shared<BerkeleyDBCXXLock>(&env_, readwrite);
+        if(readwrite) {
+            l = boost::make_shared<BerkeleyDBCXXWriteLock>(&env_, &group_commit_);
+        }
+        else {
+            l = boost::make_shared<BerkeleyDBCXXReadLock>(&env_);
+        }
         current_lock_ = l;
     }
     if(readwrite && l->readonly()) {
-        l->promote();
+        l->promote(&group_commit_);
     }
     return l;
 }
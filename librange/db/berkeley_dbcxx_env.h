@@ -56,6 +56,7 @@ class BerkeleyDBCXXEnv {
         //######################################################################
         //######################################################################
         DbEnv * getEnv() { return &env_; }
+        BerkeleyDBCXXGroupCommit& group_commit() { return group_commit_; }
         
     private:
         static std::string get_dbhome(const DbEnv *dbenv);
@@ -65,6 +66,7 @@ class BerkeleyDBCXXEnv {
         std::mutex thread_registration_lock_;
         DbEnv env_;
         range::Emitter log;
+        BerkeleyDBCXXGroupCommit group_commit_;
 
         static const uint32_t env_open_flags_ = DB_CREATE | DB_REGISTER
             | DB_THREAD | DB_FAILCHK | DB_INIT_LOCK | DB_INIT_LOG | DB_INIT_TXN
@@ -0,0 +1,159 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <sstream>
+
+#include "berkeley_dbcxx_group_commit.h"
+#include "db_exceptions.h"
+
+namespace range { namespace db {
+
+thread_local size_t BerkeleyDBCXXGroupCommit::batch_depth_ = 0;
+thread_local bool BerkeleyDBCXXGroupCommit::batch_dirty_ = false;
+
+static ::range::EmitterModuleRegistration BerkeleyDBCXXGroupCommitLogModule { "db.BerkeleyDBCXXGroupCommit" };
+//##############################################################################
+//##############################################################################
+BerkeleyDBCXXGroupCommit::BerkeleyDBCXXGroupCommit(DbEnv * env,
+        ConfigIface::durability durability, std::chrono::microseconds max_delay)
+    : env_(env), durability_(durability), max_delay_(max_delay),
+    requested_(0), flushed_(0), flushes_(0), flushing_(false),
+    log(BerkeleyDBCXXGroupCommitLogModule)
+{
+}
+
+//##############################################################################
+//##############################################################################
+uint32_t
+BerkeleyDBCXXGroupCommit::commit_flags() const
+{
+    switch(durability_) {
+        case ConfigIface::durability::WRITE_NOSYNC:
+            return DB_TXN_WRITE_NOSYNC;
+        case ConfigIface::durability::GROUP_COMMIT:
+            return DB_TXN_NOSYNC;                                               // flushed by committed()
+        case ConfigIface::durability::SYNC:
+        default:
+            return (batch_depth_ > 0) ? DB_TXN_NOSYNC : DB_TXN_SYNC;            // batches are flushed by end_batch()
+    }
+}
+
+//##############################################################################
+//##############################################################################
+void
+BerkeleyDBCXXGroupCommit::committed()
+{
+    if(durability_ == ConfigIface::durability::WRITE_NOSYNC) {
+        return;
+    }
+    if(batch_depth_ > 0) {
+        batch_dirty_ = true;
+    }
+    else if(durability_ == ConfigIface::durability::GROUP_COMMIT) {
+        this->flush();
+    }
+}
+
+//##############################################################################
+//##############################################################################
+void
+BerkeleyDBCXXGroupCommit::begin_batch()
+{
+    ++batch_depth_;
+}
+
+//##############################################################################
+//##############################################################################
+void
+BerkeleyDBCXXGroupCommit::end_batch()
+{
+    if(batch_depth_ == 0 || --batch_depth_ > 0) {
+        return;
+    }
+    if(batch_dirty_) {
+        batch_dirty_ = false;
+        this->flush();
+    }
+}
+
+//##############################################################################
+// Whoever arrives while nobody is flushing becomes the leader: it waits out
+// the batching delay (GROUP_COMMIT only), then flushes on behalf of every
+// ticket handed out by then. Everyone else waits for a flush covering theirs.
+//##############################################################################
+void
+BerkeleyDBCXXGroupCommit::flush()
+{
+    RANGE_LOG_TIMED_FUNCTION();
+    if(durability_ == ConfigIface::durability::WRITE_NOSYNC) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> guard { lock_ };
+    uint64_t ticket = ++requested_;
+    while(flushed_ < ticket) {
+        if(flushing_) {
+            flushed_cv_.wait(guard);
+            continue;
+        }
+
+        flushing_ = true;
+        if(durability_ == ConfigIface::durability::GROUP_COMMIT && max_delay_.count() > 0) {
+            auto deadline = std::chrono::steady_clock::now() + max_delay_;
+            flushed_cv_.wait_until(guard, deadline, [] { return false; });
+        }
+        uint64_t batch = requested_;
+        guard.unlock();
+
+        int rval = 0;
+        std::string error;
+        try {
+            rval = env_->log_flush(NULL);
+        } catch(DbException &e) {
+            error = e.what();
+        }
+
+        guard.lock();
+        flushing_ = false;
+        if(rval == 0 && error.empty()) {
+            LOG(debug4, "group_commit_flushed") << batch - flushed_ << " commits";
+            flushed_ = batch;
+            ++flushes_;
+        }
+        flushed_cv_.notify_all();
+
+        if(!error.empty()) {
+            THROW_STACK(DatabaseLockingException(error));
+        }
+        if(rval != 0) {
+            std::stringstream s;
+            s << "Unable to flush log: " << rval;
+            THROW_STACK(DatabaseLockingException(s.str()));
+        }
+    }
+}
+
+//##############################################################################
+//##############################################################################
+uint64_t
+BerkeleyDBCXXGroupCommit::flushes()
+{
+    std::lock_guard<std::mutex> guard { lock_ };
+    return flushes_;
+}
+
+} /* namespace db */ } /* namespace range */
@@ -0,0 +1,92 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _RANGE_DB_BERKELEY_DBCXX_GROUP_COMMIT_H
+#define _RANGE_DB_BERKELEY_DBCXX_GROUP_COMMIT_H
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+#include <db_cxx.h>
+
+#include "config_interface.h"
+#include "../core/log.h"
+
+namespace range { namespace db {
+
+//##############################################################################
+/// Decides how write transactions are committed, and makes them durable with
+/// as few log flushes as we can get away with:
+///
+///  - commits made inside a batch (one learned request, see
+///    BackendInterface::begin_write_batch()) are not flushed individually;
+///    the batch is flushed once when it ends, before the request is
+///    acknowledged.
+///  - flushes requested concurrently are coalesced; one thread flushes the
+///    log for everyone waiting, optionally after waiting up to
+///    ConfigIface::group_commit_delay() for more committers to join.
+///
+/// A flush returns only once everything committed before it was called is on
+/// disk, so requests are still acknowledged in the order they committed.
+class BerkeleyDBCXXGroupCommit {
+    public:
+        BerkeleyDBCXXGroupCommit(DbEnv * env, ConfigIface::durability durability,
+                std::chrono::microseconds max_delay);
+
+        //######################################################################
+        /// @return flags to pass DbTxn::commit() for a write transaction
+        uint32_t commit_flags() const;
+
+        //######################################################################
+        /// Call after a write transaction has committed with commit_flags()
+        void committed();
+
+        //######################################################################
+        /// Batches nest; the outermost end_batch() flushes anything committed
+        /// since the outermost begin_batch()
+        void begin_batch();
+        void end_batch();
+
+        //######################################################################
+        /// Block until everything committed so far is durable
+        void flush();
+
+        //######################################################################
+        /// @return number of log flushes made so far
+        uint64_t flushes();
+
+    private:
+        DbEnv * env_;
+        const ConfigIface::durability durability_;
+        const std::chrono::microseconds max_delay_;
+
+        std::mutex lock_;
+        std::condition_variable flushed_cv_;
+        uint64_t requested_;                                                    ///< tickets handed to flush() callers
+        uint64_t flushed_;                                                      ///< tickets up to here are durable
+        uint64_t flushes_;                                                      ///< log_flush() calls that succeeded
+        bool flushing_;
+        range::Emitter log;
+
+        thread_local static size_t batch_depth_;
+        thread_local static bool batch_dirty_;
+};
+
+} /* namespace db */ } /* namespace range */
+
+#endif
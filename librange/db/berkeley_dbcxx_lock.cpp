@@ -23,13 +23,15 @@ namespace range { namespace db {
 static ::range::EmitterModuleRegistration BerkeleyDBCXXLockLogModule { "db.BerkeleyDBCXXLock" };
 //##############################################################################
 //##############################################################################
-BerkeleyDBCXXLock::BerkeleyDBCXXLock(DbEnv * env, bool readwrite)
-    : env_(env), readwrite_(readwrite), log(BerkeleyDBCXXLockLogModule)
+BerkeleyDBCXXLock::BerkeleyDBCXXLock(DbEnv * env, BerkeleyDBCXXGroupCommit * group_commit)
+    : env_(env), readwrite_(group_commit != nullptr), group_commit_(group_commit),
+    cache_generations_(),
+    log(BerkeleyDBCXXLockLogModule)
 {
     RANGE_LOG_FUNCTION();
     int rval = 0;
     try {
-        rval = env_->txn_begin(NULL, &txn_, DB_TXN_SYNC | DB_TXN_WAIT | DB_TXN_SNAPSHOT);
+        rval = env_->txn_begin(NULL, &txn_, DB_TXN_WAIT | DB_TXN_SNAPSHOT);
     } catch(DbException &e) {
         THROW_STACK(DatabaseLockingException("Unable to create locking transaction"));
     }
@@ -86,6 +88,32 @@ BerkeleyDBCXXLock::~BerkeleyDBCXXLock() noexcept
     }
 }
 
+//##############################################################################
+//##############################################################################
+void
+BerkeleyDBCXXLock::promote(BerkeleyDBCXXGroupCommit * group_commit)
+{
+    readwrite_ = true;
+    group_commit_ = group_commit;
+}
+
+//##############################################################################
+//##############################################################################
+uint64_t
+BerkeleyDBCXXLock::cache_generation(const std::string &graph) const
+{
+    auto it = cache_generations_.find(graph);
+    return (it == cache_generations_.end()) ? 0 : it->second;
+}
+
+//##############################################################################
+//##############################################################################
+void
+BerkeleyDBCXXLock::set_cache_generation(const std::string &graph, uint64_t generation)
+{
+    cache_generations_[graph] = generation;
+}
+
 //##############################################################################
 //##############################################################################
 void
@@ -94,7 +122,7 @@ BerkeleyDBCXXLock::unlock()
     RANGE_LOG_TIMED_FUNCTION();
     int rval = 0;
     try {
-        rval = txn_->commit(DB_TXN_SYNC);
+        rval = txn_->commit(readwrite_ ? group_commit_->commit_flags() : DB_TXN_NOSYNC);
     } catch (DbException &e) {
         THROW_STACK(DatabaseLockingException(e.what()));
     } catch(std::exception &e) {
@@ -102,6 +130,9 @@ BerkeleyDBCXXLock::unlock()
     }
     switch(rval) {
         case 0:
+            if(readwrite_) {
+                group_commit_->committed();
+            }
             break;
         case DB_LOCK_DEADLOCK:
             THROW_STACK(DatabaseLockingException("DB_LOCK_DEADLOCK"));
@@ -17,32 +17,74 @@
 #ifndef _RANGE_DB_BERKELEY_DBCXX_LOCK_H
 #define _RANGE_DB_BERKELEY_DBCXX_LOCK_H
 
+#include <string>
+#include <unordered_map>
+
 #include <db_cxx.h>
 
 #include "../core/log.h"
 
 #include "db_interface.h"
+#include "berkeley_dbcxx_group_commit.h"
 
 namespace range { namespace db {
 
 //##############################################################################
+// Holds the thread's BerkeleyDB transaction; see BerkeleyDBCXXReadLock and
+// BerkeleyDBCXXWriteLock for how it is begun and released
 //##############################################################################
 class BerkeleyDBCXXLock : public GraphInstanceLock {
     public:
-        BerkeleyDBCXXLock(DbEnv * env, bool readwrite=false);
         virtual ~BerkeleyDBCXXLock() noexcept override;
         virtual void unlock() override;
         virtual bool readonly() override { return !readwrite_; };
-        void promote() { readwrite_ = true; }
+        void promote(BerkeleyDBCXXGroupCommit * group_commit);                  ///< the thread wrote while holding a read lock
+        uint64_t cache_generation(const std::string &graph) const;             ///< NodeInfoCache generation of graph in our snapshot, or 0 if not yet read
+        void set_cache_generation(const std::string &graph, uint64_t generation);
+    protected:
+        BerkeleyDBCXXLock(DbEnv * env, BerkeleyDBCXXGroupCommit * group_commit);
     private:
         friend class BerkeleyDBCXXLockTxnGetter;
         DbEnv * env_;
         bool readwrite_;
+        BerkeleyDBCXXGroupCommit * group_commit_;                               ///< null for read-only locks
         DbTxn * txn_;
         bool initialized_;
+        std::unordered_map<std::string, uint64_t> cache_generations_;          ///< read once per graph; the snapshot can't see them change
         range::Emitter log;
 };
 
+//##############################################################################
+// Read-only MVCC snapshot; writes nothing to the log, so it is released
+// without any durability work
+//##############################################################################
+class BerkeleyDBCXXReadLock : public BerkeleyDBCXXLock {
+    public:
+        explicit BerkeleyDBCXXReadLock(DbEnv * env)
+            : BerkeleyDBCXXLock(env, nullptr) { }
+};
+
+//##############################################################################
+// Committed as durably as the deployment asks for (ConfigIface::write_durability);
+// see BerkeleyDBCXXGroupCommit
+//##############################################################################
+class BerkeleyDBCXXWriteLock : public BerkeleyDBCXXLock {
+    public:
+        BerkeleyDBCXXWriteLock(DbEnv * env, BerkeleyDBCXXGroupCommit * group_commit)
+            : BerkeleyDBCXXLock(env, group_commit) { }
+};
+
+//##############################################################################
+// Holding the lock keeps its DB_TXN_SNAPSHOT transaction open; reads on this
+// thread pick it up through BerkeleyDBCXXEnv::acquire_DbTxn_lock()
+//##############################################################################
+class BerkeleyDBCXXSnapshot : public ReadSnapshot {
+    public:
+        explicit BerkeleyDBCXXSnapshot(boost::shared_ptr<BerkeleyDBCXXLock> lock) : lock_(lock) { }
+    private:
+        boost::shared_ptr<BerkeleyDBCXXLock> lock_;
+};
+
 //##############################################################################
 //##############################################################################
 class BerkeleyDBCXXLockTxnGetter {
@@ -23,6 +23,7 @@
 #include "db_exceptions.h"
 #include "berkeley_dbcxx_env.h"
 #include "berkeley_dbcxx_txlog.h"
+#include "berkeley_dbcxx_buffer.h"
 #include "txlog_iterator.h"
 
 namespace range { namespace db {
@@ -83,38 +84,30 @@ class BerkeleyDBCXXTxLogCursor : public TxLogCursorInterface
         bool fetch_from_dbc(db_recno_t key, int flags,
                     db_recno_t * keybuf, std::string &databuf) const
         {
-            size_t localdatabuf_size = 131072;
-            std::unique_ptr<char[]> localdatabuf { nullptr };
-
             if(key != std::numeric_limits<uint32_t>::max()) {
                 *keybuf = key;
             }
             Dbt dbkey { (void *) keybuf, sizeof(*keybuf) };;
-            Dbt dbdata;
+            Dbt &dbdata = read_buffer_.dbt();
             int dbrval = 0;
 
             do {
-                if(localdatabuf) {
-                    LOG(debug0, "resizing_record_buffer") << localdatabuf_size;
-                }
-                
-                localdatabuf = std::unique_ptr<char[]>(new char[localdatabuf_size]);
-                dbdata = Dbt(localdatabuf.get(), localdatabuf_size);
-                dbdata.set_ulen(localdatabuf_size);
-                dbdata.set_flags(DB_DBT_USERMEM);
-                localdatabuf_size *= 2;
-
                 try {
                     dbrval = cur_->get(&dbkey, &dbdata, flags);
                 }
                 catch (DbException &e) {
-                    if(e.get_errno() == DB_BUFFER_SMALL) { continue; }
-                    THROW_STACK(CursorException(e.what()));
+                    if(e.get_errno() != DB_BUFFER_SMALL) {
+                        THROW_STACK(CursorException(e.what()));
+                    }
+                    dbrval = DB_BUFFER_SMALL;
                 }
                 catch (std::exception &e) {
                     THROW_STACK(CursorException(e.what()));
                 }
-            } while(dbrval == DB_BUFFER_SMALL);
+                if(dbrval == DB_BUFFER_SMALL) {
+                    LOG(debug0, "resizing_record_buffer") << dbdata.get_size();
+                }
+            } while(dbrval == DB_BUFFER_SMALL && read_buffer_.grow());
 
             switch(dbrval) {
                 case 0:
@@ -141,7 +134,7 @@ class BerkeleyDBCXXTxLogCursor : public TxLogCursorInterface
                     break;
             }
 
-            databuf = std::string((char *) dbdata.get_data(), dbdata.get_size());
+            databuf = read_buffer_.str();
             return true;
         }
 
@@ -221,8 +214,12 @@ class BerkeleyDBCXXTxLogCursor : public TxLogCursorInterface
         Dbc * cur_;
         boost::shared_ptr<BerkeleyDBCXXLock> lock_txn_;
         range::Emitter log;
+
+        thread_local static BerkeleyDBCXXBuffer read_buffer_;                  // reused by every txlog read on this thread
 };
 
+thread_local BerkeleyDBCXXBuffer BerkeleyDBCXXTxLogCursor::read_buffer_;
+
 
 
 //##############################################################################
@@ -64,15 +64,14 @@ BerkeleyDBCXXTxn::commit()
 {
     RANGE_LOG_TIMED_FUNCTION();
     auto lck = db_->write_lock(record_type::GRAPH_META, "changelist");
-    ChangeList changes = db_->read_changelist();
     bool node_changes = false;
     if(!this->pending_changes_.empty()) {
-        ChangeList_Change * new_c = changes.add_change();
+        ChangeList_Change new_c;
 
         struct timeval cur_time;
         gettimeofday(&cur_time, NULL);
 
-        auto ts = new_c->mutable_timestamp();
+        auto ts = new_c.mutable_timestamp();
         ts->set_seconds(cur_time.tv_sec);
         ts->set_msec(cur_time.tv_usec / 1000);
 
@@ -86,7 +85,7 @@ BerkeleyDBCXXTxn::commit()
                 case record_type::NODE:
                     node_changes = true;
                     fullkey = db_->key_name(type, key);
-                    new_item = new_c->add_items();
+                    new_item = new_c.add_items();
                     new_item->set_key(fullkey);
                     new_item->set_version(object_version);
                     break;
@@ -95,10 +94,12 @@ BerkeleyDBCXXTxn::commit()
             }
             if(!data.empty()) {
                 db_->commit_record(c.second);
+            } else {
+                db_->delete_record(type, key);                                  // an empty record reads the same as a missing one
             }
         }
         if(node_changes) { 
-            this->add_graph_changelist(changes);
+            this->add_graph_change(new_c);
         }
         this->pending_changes_.clear();
     }
@@ -117,6 +118,8 @@ BerkeleyDBCXXTxn::flush()
         std::tie(type, key, object_version, data) = c.second;
         if(!data.empty()) {
             db_->commit_record(c.second);
+        } else {
+            db_->delete_record(type, key);
         }
         data.clear();
         data.shrink_to_fit();
@@ -169,15 +172,39 @@ BerkeleyDBCXXTxn::get_record(record_type type, const std::string &key, std::stri
     return true;
 }
 
+//##############################################################################
+//##############################################################################
+std::vector<std::string>
+BerkeleyDBCXXTxn::pending_keys(record_type type, const std::string &prefix) const
+{
+    RANGE_LOG_FUNCTION();
+    std::vector<std::string> keys;
+    for(auto &c : this->pending_changes_) {
+        record_type foundtype;
+        std::string foundkey, data;
+        uint64_t object_version;
+        std::tie(foundtype, foundkey, object_version, data) = c.second;
+        if(foundtype == type && foundkey.compare(0, prefix.size(), prefix) == 0) {
+            keys.push_back(foundkey);
+        }
+    }
+    return keys;
+}
+
 
 //##############################################################################
 //##############################################################################
 bool
-BerkeleyDBCXXTxn::add_graph_changelist(ChangeList &changes)
+BerkeleyDBCXXTxn::add_graph_change(const ChangeList_Change &change)
 {
   RANGE_LOG_FUNCTION();
-  changes.set_current_version(changes.current_version() + 1);
-  return db_->commit_record(std::make_tuple(record_type::GRAPH_META, "changelist", 0, changes.SerializeAsString()));
+  db_->migrate_changelist();
+  uint64_t version = db_->committed_version() + 1;
+  db_->commit_record(std::make_tuple(record_type::GRAPH_META, BerkeleyDBCXXDb::changelist_key(version), 0,
+              change.SerializeAsString()));
+  db_->add_node_history(version, change);
+  return db_->commit_record(std::make_tuple(record_type::GRAPH_META, "version", 0,
+              std::to_string(static_cast<unsigned long long>(version))));
 }
 
 } /* namespace db */ } /* namespace range */
@@ -45,8 +45,9 @@ class BerkeleyDBCXXTxn : public GraphTransaction {
         size_t pending() const;
         bool add_change(change_t);
         bool get_record(record_type type, const std::string &key, std::string &value) const;
+        std::vector<std::string> pending_keys(record_type type, const std::string &prefix) const;
     private:
-        bool add_graph_changelist(ChangeList &changes);
+        bool add_graph_change(const ChangeList_Change &change);
 
         std::unordered_map<std::string, change_t> pending_changes_;
         boost::shared_ptr<BerkeleyDBCXXDb> db_;
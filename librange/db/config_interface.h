@@ -18,6 +18,7 @@
 #ifndef _RANGE_DB_CONFIG_INTERFACE_H
 #define _RANGE_DB_CONFIG_INTERFACE_H
 
+#include <chrono>
 #include <string>
 
 namespace range {
@@ -25,19 +26,51 @@ namespace db {
 
 class ConfigIface {
     public:
-        ConfigIface() : db_home_("/var/lib/rangexx"), cache_size_(67108864) { }
-        ConfigIface(std::string db_home, size_t cache_size) 
-            : db_home_(db_home), cache_size_(cache_size)
+        //######################################################################
+        /// What a write transaction waits for before its commit returns
+        enum class durability {
+            SYNC,                                                               ///< log written and flushed to disk
+            WRITE_NOSYNC,                                                       ///< log written to the OS, not flushed; survives a crash of the process, not of the machine
+            GROUP_COMMIT                                                        ///< log flushed to disk, once for every commit waiting on it (see group_commit_delay)
+        };
+
+        //######################################################################
+        /// How newly created graph databases are laid out; existing ones keep
+        /// the layout they were created with
+        enum class access_method {
+            HASH,                                                               ///< DB_HASH, text keys; scans visit every record
+            BTREE                                                               ///< DB_BTREE, binary type prefix; records of a type (and names with a common prefix) are contiguous
+        };
+
+        ConfigIface() : db_home_("/var/lib/rangexx"), cache_size_(67108864),
+            node_cache_size_(65536), write_durability_(durability::SYNC),
+            group_commit_delay_(0), graph_access_method_(access_method::HASH) { }
+        ConfigIface(std::string db_home, size_t cache_size,
+                size_t node_cache_size = 65536,
+                durability write_durability = durability::SYNC,
+                std::chrono::microseconds group_commit_delay = std::chrono::microseconds(0),
+                access_method graph_access_method = access_method::HASH)
+            : db_home_(db_home), cache_size_(cache_size),
+            node_cache_size_(node_cache_size), write_durability_(write_durability),
+            group_commit_delay_(group_commit_delay), graph_access_method_(graph_access_method)
         {
         }
         virtual ~ConfigIface() = default;
 
         virtual const std::string& db_home() const { return db_home_; }
         virtual size_t cache_size() const { return cache_size_; }
+        virtual size_t node_cache_size() const { return node_cache_size_; }   ///< decoded nodes kept in-process (0 disables)
+        virtual durability write_durability() const { return write_durability_; }
+        virtual std::chrono::microseconds group_commit_delay() const { return group_commit_delay_; } ///< longest GROUP_COMMIT waits for others to share a flush
+        virtual access_method graph_access_method() const { return graph_access_method_; }
 
     private:
         std::string db_home_;
         size_t cache_size_;
+        size_t node_cache_size_;
+        durability write_durability_;
+        std::chrono::microseconds group_commit_delay_;
+        access_method graph_access_method_;
 
 };
 
@@ -24,6 +24,12 @@
 #include <boost/shared_ptr.hpp>
 #include <memory>
 #include <ctime>
+#include <functional>
+#include <mutex>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include "../graph/node_interface.h"
 #include "../graph/graph_interface.h"
@@ -70,6 +76,21 @@ class GraphInstanceLock {
         GraphInstanceLock() = default;
 };
 
+//##############################################################################
+// RAII base-class; while a thread holds one, every read it makes sees the
+// database as it was when the snapshot was taken
+//##############################################################################
+class ReadSnapshot {
+    public:
+        ReadSnapshot(const ReadSnapshot& other) = delete;
+        ReadSnapshot(ReadSnapshot& other) = delete;
+        ReadSnapshot(ReadSnapshot&& other) = default;
+
+        virtual ~ReadSnapshot() = default;
+    protected:
+        ReadSnapshot() = default;
+};
+
 //##############################################################################
 /// Interface class for graph instances 
 ///
@@ -87,6 +108,14 @@ class GraphInstanceInterface {
         typedef std::vector<change_t> changelist_t;
         typedef std::list<changelist_t> history_list_t;
 
+        //######################################################################
+        /// How node records are written (see NodeRecord); readers tell them
+        /// apart by their contents
+        enum class node_encoding {
+            PROTOBUF,                                                           ///< one serialized NodeInfo
+            SECTIONED                                                           ///< header, tags and edges serialized separately; each decoded on demand
+        };
+
         //######################################################################
         virtual ~GraphInstanceInterface() = default;
 
@@ -149,6 +178,19 @@ class GraphInstanceInterface {
         /// @return true if successfull, false otherwise. throws on error
         virtual bool write_record(record_type type, const std::string& key,
                 uint64_t object_version, const std::string& data) = 0;
+
+        //######################################################################
+        /// Delete every committed record of type whose key starts with
+        /// prefix, as part of the current write transaction. Backends that
+        /// can't list their records leave them in place.
+        ///
+        /// @param[in] type type of the records to delete
+        /// @param[in] prefix start of their keys
+        /// @return number of records deleted
+        virtual size_t remove_records(record_type type, const std::string& prefix) {
+            (void)type; (void)prefix;
+            return 0;
+        }
         
         //######################################################################
         /// @param[in] version graph version you want to query
@@ -160,6 +202,74 @@ class GraphInstanceInterface {
         ///          vectors of change tuples)
         virtual history_list_t get_change_history() const = 0;
 
+        //######################################################################
+        /// Instances that index their history per node should override this;
+        /// the default walks get_change_history().
+        ///
+        /// @param[in] name name of the node
+        /// @param[in] version graph version
+        /// @return the object version the node was last written with at or
+        ///         before the graph version, or -1 if it wasn't
+        virtual uint64_t node_version_at(const std::string& name, uint64_t version) const {
+            uint64_t found = -1;
+            uint64_t v = 0;
+            for (auto &changes : this->get_change_history()) {
+                if (++v > version) {
+                    break;
+                }
+                for (auto &change : changes) {
+                    if (std::get<0>(change) == record_type::NODE && std::get<1>(change) == name) {
+                        found = std::get<2>(change);
+                    }
+                }
+            }
+            return found;
+        }
+
+        //######################################################################
+        /// Instances that keep each version's changes separately should
+        /// override this; the default walks get_change_history().
+        ///
+        /// @param[in] version graph version, from 1
+        /// @param[out] change what version changed
+        /// @return false if there is no such version
+        virtual bool get_change(uint64_t version, changelist_t &change) const {
+            uint64_t v = 0;
+            for (auto &changes : this->get_change_history()) {
+                if (++v == version) {
+                    change = changes;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        //######################################################################
+        /// @return name of the graph, used to key process-wide caches
+        virtual std::string graph_name() const { return std::string(); }
+
+        //######################################################################
+        /// Decoded copies of records may be shared between readers that
+        /// observe the same cache generation. Call while holding a lock.
+        ///
+        /// @param[in] type type of the record about to be read
+        /// @param[in] key key of the record about to be read
+        /// @return generation of the current snapshot, or 0 if the record
+        ///         must be read from the backend (the default)
+        virtual uint64_t cache_generation(record_type type, const std::string& key) const {
+            (void)type; (void)key;
+            return 0;
+        }
+
+        //######################################################################
+        /// Chosen per graph, by range_upgrade --node-encoding
+        ///
+        /// @return encoding node records are written in (PROTOBUF, the
+        ///         default, for backends that don't keep one)
+        virtual node_encoding node_record_encoding() const {
+            return node_encoding::PROTOBUF;
+        }
+
     //##########################################################################
     //##########################################################################
     protected:
@@ -245,6 +355,17 @@ class BackendInterface {
         typedef boost::shared_ptr<TxLogInstanceInterface> txlog_instance_t;
         typedef RangeTxn txn_type;
         typedef boost::shared_ptr<txn_type> txn_type_p;
+        typedef boost::shared_ptr<ReadSnapshot> read_snapshot_t;
+
+        //######################################################################
+        /// The nodes one version of a graph changed
+        struct graph_delta_t {
+            std::string graph;
+            uint64_t version;
+            std::vector<std::string> nodes;                                     ///< names of the NODE records written
+        };
+        typedef std::function<void(const graph_delta_t&)> delta_fn_t;
+        typedef boost::shared_ptr<void> subscription_t;
 
         //######################################################################
         virtual ~BackendInterface() = default;
@@ -266,13 +387,114 @@ class BackendInterface {
         virtual range_changelist_t get_changelist() = 0;
         virtual uint64_t get_graph_wanted_version(const std::string &graph_name) const = 0;
 
+        //######################################################################
+        /// Backends that index their changelist by time should override this;
+        /// the default walks get_changelist().
+        ///
+        /// @param[in] when point in time
+        /// @return the range version current at when, or -1 if when predates
+        ///         the first range version
+        virtual uint64_t range_version_at(std::time_t when) {
+            uint64_t found = -1;
+            for (auto &c : this->get_changelist()) {
+                if (std::get<0>(c) < when) {
+                    found = std::get<1>(c) + 1;
+                }
+            }
+            return found;
+        }
+
+        //######################################################################
+        /// Commits made on the calling thread between begin_write_batch() and
+        /// the matching end_write_batch() are made durable together, by
+        /// end_write_batch(); batches nest. Callers must call end_write_batch()
+        /// before acknowledging the writes, and treat an exception from it as
+        /// a failure to persist them. Backends without batching do nothing.
+        virtual void begin_write_batch() { }
+        virtual void end_write_batch() { }
+
+        //######################################################################
+        /// Hold the returned snapshot for the length of a read-only operation
+        /// so that all of its reads, across every graph instance, share one
+        /// consistent view (and one backend transaction). Backends without
+        /// snapshots return nullptr, and every read sees the latest data.
+        ///
+        /// @return snapshot, released when the last reference goes away
+        virtual read_snapshot_t read_snapshot() const {
+            return read_snapshot_t();
+        }
+
+        //######################################################################
+        /// Subscribe to the changes made to graph after from_version, so that
+        /// an in-memory copy of it can re-read just the nodes that changed.
+        /// Deltas are delivered, in version order, by catch_up_deltas(); fn
+        /// must not call back into the subscription functions. Backends
+        /// without a changelist return nullptr, and their subscribers should
+        /// reload everything instead.
+        ///
+        /// @param[in] graph name of the graph instance
+        /// @param[in] from_version last version the subscriber has seen
+        /// @param[in] fn called once for each later version
+        /// @return subscription; fn is dropped when the last reference goes
+        virtual subscription_t subscribe_deltas(const std::string &graph,
+                uint64_t from_version, delta_fn_t fn) {
+            (void)(graph); (void)(from_version); (void)(fn);
+            return subscription_t();
+        }
+
+        //######################################################################
+        /// Deliver graph's versions committed since its subscribers last
+        /// heard, whichever process committed them. Call outside of write
+        /// transactions, e.g. after a learned write or before a read.
+        ///
+        /// @param[in] graph name of the graph instance
+        /// @return false if a version's changes couldn't be read; the
+        ///         subscribers have had every version before it
+        virtual bool catch_up_deltas(const std::string &graph) {
+            (void)(graph);
+            return false;
+        }
+
         virtual void shutdown(bool terminal=false) = 0;
 
+        //######################################################################
+        /// What the process keeps in memory about one of this backend's
+        /// graphs (snapshots, caches, the feeds that keep them current): one
+        /// T per graph, made by make() on first ask and kept for as long as
+        /// the backend is. Backends on different db homes never share it.
+        ///
+        /// @param[in] graph name of the graph instance
+        /// @param[in] make returns a new boost::shared_ptr<T>; may itself ask
+        ///            for graph_state()
+        template <typename T, typename Make>
+        boost::shared_ptr<T> graph_state(const std::string &graph, Make make) {
+            auto key = std::make_pair(graph, std::type_index(typeid(T)));
+            {
+                std::lock_guard<std::mutex> guard { graph_state_lock_ };
+                auto it = graph_state_.find(key);
+                if (it != graph_state_.end()) {
+                    return boost::static_pointer_cast<T>(it->second);
+                }
+            }
+            boost::shared_ptr<T> made = make();
+            std::lock_guard<std::mutex> guard { graph_state_lock_ };
+            auto &state = graph_state_[key];
+            if (!state) {                                                       // unless another thread got there first
+                state = made;
+            }
+            return boost::static_pointer_cast<T>(state);
+        }
+
     //##########################################################################
     //##########################################################################
     protected:
         BackendInterface() = default;
 
+    //##########################################################################
+    //##########################################################################
+    private:
+        std::mutex graph_state_lock_;
+        std::map<std::pair<std::string, std::type_index>, boost::shared_ptr<void>> graph_state_;
 };
 
 } // namespace db
@@ -0,0 +1,104 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+
+#include "delta_feed.h"
+
+namespace range { namespace db {
+
+static ::range::EmitterModuleRegistration DeltaFeedLogModule { "db.DeltaFeed" };
+
+//##############################################################################
+//##############################################################################
+DeltaFeed::DeltaFeed()
+    : lock_(), subscribers_(), log(DeltaFeedLogModule)
+{
+}
+
+//##############################################################################
+//##############################################################################
+DeltaFeed::subscription_t
+DeltaFeed::subscribe(const std::string &graph, uint64_t from_version, delta_fn_t fn)
+{
+    BOOST_LOG_FUNCTION();
+    auto sub = boost::make_shared<subscriber_t>();
+    sub->graph = graph;
+    sub->version = from_version;
+    sub->fn = fn;
+
+    std::lock_guard<std::mutex> guard { lock_ };
+    subscribers_.push_back(sub);
+    return sub;
+}
+
+//##############################################################################
+//##############################################################################
+bool
+DeltaFeed::catch_up(const std::string &graph, const GraphInstanceInterface &instance)
+{
+    BOOST_LOG_FUNCTION();
+    std::lock_guard<std::mutex> guard { lock_ };
+
+    uint64_t head = instance.version();
+    uint64_t from = head;
+    std::vector<boost::shared_ptr<subscriber_t>> behind;
+    for (auto it = subscribers_.begin(); it != subscribers_.end(); ) {
+        auto sub = it->lock();
+        if (!sub) {
+            it = subscribers_.erase(it);
+            continue;
+        }
+        if (sub->graph == graph && sub->version < head) {
+            from = std::min(from, sub->version);
+            behind.push_back(sub);
+        }
+        ++it;
+    }
+
+    bool complete = true;
+    std::vector<graph_delta_t> deltas;                                          // read once, however many want them
+    for (uint64_t v = from + 1; v <= head && !behind.empty(); ++v) {
+        GraphInstanceInterface::changelist_t changes;
+        if (!instance.get_change(v, changes)) {
+            LOG(warning, "delta_missing") << graph << ':' << v;
+            complete = false;
+            break;
+        }
+        graph_delta_t delta { graph, v, { } };
+        for (auto &c : changes) {
+            if (std::get<0>(c) == GraphInstanceInterface::record_type::NODE) {
+                delta.nodes.push_back(std::get<1>(c));
+            }
+        }
+        deltas.push_back(std::move(delta));
+    }
+
+    for (auto &sub : behind) {
+        for (auto &delta : deltas) {
+            if (delta.version > sub->version) {
+                sub->fn(delta);
+                sub->version = delta.version;
+            }
+        }
+    }
+    return complete;
+}
+
+} /* namespace db */ } /* namespace range */
@@ -0,0 +1,73 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _RANGE_DB_DELTA_FEED_H
+#define _RANGE_DB_DELTA_FEED_H
+
+#include <list>
+#include <mutex>
+#include <string>
+
+#include <boost/weak_ptr.hpp>
+
+#include "../core/log.h"
+
+#include "db_interface.h"
+
+namespace range { namespace db {
+
+//##############################################################################
+/// The subscribers of BackendInterface::subscribe_deltas(), for backends to
+/// delegate to. Each version's changes are read back from the graph
+/// instance with get_change(), so a process sees versions committed by
+/// another one just the same as its own.
+class DeltaFeed {
+    public:
+        typedef BackendInterface::graph_delta_t graph_delta_t;
+        typedef BackendInterface::delta_fn_t delta_fn_t;
+        typedef BackendInterface::subscription_t subscription_t;
+
+        //######################################################################
+        DeltaFeed();
+
+        //######################################################################
+        /// See BackendInterface::subscribe_deltas()
+        subscription_t subscribe(const std::string &graph, uint64_t from_version,
+                delta_fn_t fn);
+
+        //######################################################################
+        /// See BackendInterface::catch_up_deltas()
+        ///
+        /// @param[in] instance graph's instance, read up to its version()
+        bool catch_up(const std::string &graph, const GraphInstanceInterface &instance);
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        struct subscriber_t {
+            std::string graph;
+            uint64_t version;                                                   ///< last version delivered
+            delta_fn_t fn;
+        };
+
+        std::mutex lock_;                                                       ///< held while delivering, so deltas arrive in order
+        std::list<boost::weak_ptr<subscriber_t>> subscribers_;                  ///< subscriptions own them
+        range::Emitter log;
+};
+
+} /* namespace db */ } /* namespace range */
+
+#endif
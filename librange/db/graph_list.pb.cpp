@@ -1,314 +0,0 @@
-// Generated by the protocol buffer compiler.  DO NOT EDIT!
-// source: graph_list.proto
-
-#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
-#include "graph_list.pb.h"
-
-#include <algorithm>
-
-#include <google/protobuf/stubs/common.h>
-#include <google/protobuf/stubs/once.h>
-#include <google/protobuf/io/coded_stream.h>
-#include <google/protobuf/wire_format_lite_inl.h>
-#include <google/protobuf/descriptor.h>
-#include <google/protobuf/generated_message_reflection.h>
-#include <google/protobuf/reflection_ops.h>
-#include <google/protobuf/wire_format.h>
-// @@protoc_insertion_point(includes)
-
-namespace range {
-namespace db {
-
-namespace {
-
-const ::google::protobuf::Descriptor* GraphList_descriptor_ = NULL;
-const ::google::protobuf::internal::GeneratedMessageReflection*
-  GraphList_reflection_ = NULL;
-
-}  // namespace
-
-
-void protobuf_AssignDesc_graph_5flist_2eproto() {
-  protobuf_AddDesc_graph_5flist_2eproto();
-  const ::google::protobuf::FileDescriptor* file =
-    ::google::protobuf::DescriptorPool::generated_pool()->FindFileByName(
-      "graph_list.proto");
-  GOOGLE_CHECK(file != NULL);
-  GraphList_descriptor_ = file->message_type(0);
-  static const int GraphList_offsets_[1] = {
-    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GraphList, name_),
-  };
-  GraphList_reflection_ =
-    new ::google::protobuf::internal::GeneratedMessageReflection(
-      GraphList_descriptor_,
-      GraphList::default_instance_,
-      GraphList_offsets_,
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GraphList, _has_bits_[0]),
-      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(GraphList, _unknown_fields_),
-      -1,
-      ::google::protobuf::DescriptorPool::generated_pool(),
-      ::google::protobuf::MessageFactory::generated_factory(),
-      sizeof(GraphList));
-}
-
-namespace {
-
-GOOGLE_PROTOBUF_DECLARE_ONCE(protobuf_AssignDescriptors_once_);
-inline void protobuf_AssignDescriptorsOnce() {
-  ::google::protobuf::GoogleOnceInit(&protobuf_AssignDescriptors_once_,
-                 &protobuf_AssignDesc_graph_5flist_2eproto);
-}
-
-void protobuf_RegisterTypes(const ::std::string&) {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedMessage(
-    GraphList_descriptor_, &GraphList::default_instance());
-}
-
-}  // namespace
-
-void protobuf_ShutdownFile_graph_5flist_2eproto() {
-  delete GraphList::default_instance_;
-  delete GraphList_reflection_;
-}
-
-void protobuf_AddDesc_graph_5flist_2eproto() {
-  static bool already_here = false;
-  if (already_here) return;
-  already_here = true;
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  ::google::protobuf::DescriptorPool::InternalAddGeneratedFile(
-    "\n\020graph_list.proto\022\010range.db\"\031\n\tGraphLis"
-    "t\022\014\n\004name\030\001 \003(\t", 55);
-  ::google::protobuf::MessageFactory::InternalRegisterGeneratedFile(
-    "graph_list.proto", &protobuf_RegisterTypes);
-  GraphList::default_instance_ = new GraphList();
-  GraphList::default_instance_->InitAsDefaultInstance();
-  ::google::protobuf::internal::OnShutdown(&protobuf_ShutdownFile_graph_5flist_2eproto);
-}
-
-// Force AddDescriptors() to be called at static initialization time.
-struct StaticDescriptorInitializer_graph_5flist_2eproto {
-  StaticDescriptorInitializer_graph_5flist_2eproto() {
-    protobuf_AddDesc_graph_5flist_2eproto();
-  }
-} static_descriptor_initializer_graph_5flist_2eproto_;
-
-// ===================================================================
-
-#ifndef _MSC_VER
-const int GraphList::kNameFieldNumber;
-#endif  // !_MSC_VER
-
-GraphList::GraphList()
-  : ::google::protobuf::Message() {
-  SharedCtor();
-}
-
-void GraphList::InitAsDefaultInstance() {
-}
-
-GraphList::GraphList(const GraphList& from)
-  : ::google::protobuf::Message() {
-  SharedCtor();
-  MergeFrom(from);
-}
-
-void GraphList::SharedCtor() {
-  _cached_size_ = 0;
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-}
-
-GraphList::~GraphList() {
-  SharedDtor();
-}
-
-void GraphList::SharedDtor() {
-  if (this != default_instance_) {
-  }
-}
-
-void GraphList::SetCachedSize(int size) const {
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-}
-const ::google::protobuf::Descriptor* GraphList::descriptor() {
-  protobuf_AssignDescriptorsOnce();
-  return GraphList_descriptor_;
-}
-
-const GraphList& GraphList::default_instance() {
-  if (default_instance_ == NULL) protobuf_AddDesc_graph_5flist_2eproto();
-  return *default_instance_;
-}
-
-GraphList* GraphList::default_instance_ = NULL;
-
-GraphList* GraphList::New() const {
-  return new GraphList;
-}
-
-void GraphList::Clear() {
-  name_.Clear();
-  ::memset(_has_bits_, 0, sizeof(_has_bits_));
-  mutable_unknown_fields()->Clear();
-}
-
-bool GraphList::MergePartialFromCodedStream(
-    ::google::protobuf::io::CodedInputStream* input) {
-#define DO_(EXPRESSION) if (!(EXPRESSION)) return false
-  ::google::protobuf::uint32 tag;
-  while ((tag = input->ReadTag()) != 0) {
-    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
-      // repeated string name = 1;
-      case 1: {
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED) {
-         parse_name:
-          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
-                input, this->add_name()));
-          ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-            this->name(this->name_size() - 1).data(),
-            this->name(this->name_size() - 1).length(),
-            ::google::protobuf::internal::WireFormat::PARSE);
-        } else {
-          goto handle_uninterpreted;
-        }
-        if (input->ExpectTag(10)) goto parse_name;
-        if (input->ExpectAtEnd()) return true;
-        break;
-      }
-
-      default: {
-      handle_uninterpreted:
-        if (::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
-            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
-          return true;
-        }
-        DO_(::google::protobuf::internal::WireFormat::SkipField(
-              input, tag, mutable_unknown_fields()));
-        break;
-      }
-    }
-  }
-  return true;
-#undef DO_
-}
-
-void GraphList::SerializeWithCachedSizes(
-    ::google::protobuf::io::CodedOutputStream* output) const {
-  // repeated string name = 1;
-  for (int i = 0; i < this->name_size(); i++) {
-  ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-    this->name(i).data(), this->name(i).length(),
-    ::google::protobuf::internal::WireFormat::SERIALIZE);
-    ::google::protobuf::internal::WireFormatLite::WriteString(
-      1, this->name(i), output);
-  }
-
-  if (!unknown_fields().empty()) {
-    ::google::protobuf::internal::WireFormat::SerializeUnknownFields(
-        unknown_fields(), output);
-  }
-}
-
-::google::protobuf::uint8* GraphList::SerializeWithCachedSizesToArray(
-    ::google::protobuf::uint8* target) const {
-  // repeated string name = 1;
-  for (int i = 0; i < this->name_size(); i++) {
-    ::google::protobuf::internal::WireFormat::VerifyUTF8String(
-      this->name(i).data(), this->name(i).length(),
-      ::google::protobuf::internal::WireFormat::SERIALIZE);
-    target = ::google::protobuf::internal::WireFormatLite::
-      WriteStringToArray(1, this->name(i), target);
-  }
-
-  if (!unknown_fields().empty()) {
-    target = ::google::protobuf::internal::WireFormat::SerializeUnknownFieldsToArray(
-        unknown_fields(), target);
-  }
-  return target;
-}
-
-int GraphList::ByteSize() const {
-  int total_size = 0;
-
-  // repeated string name = 1;
-  total_size += 1 * this->name_size();
-  for (int i = 0; i < this->name_size(); i++) {
-    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
-      this->name(i));
-  }
-
-  if (!unknown_fields().empty()) {
-    total_size +=
-      ::google::protobuf::internal::WireFormat::ComputeUnknownFieldsSize(
-        unknown_fields());
-  }
-  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
-  _cached_size_ = total_size;
-  GOOGLE_SAFE_CONCURRENT_WRITES_END();
-  return total_size;
-}
-
-void GraphList::MergeFrom(const ::google::protobuf::Message& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  const GraphList* source =
-    ::google::protobuf::internal::dynamic_cast_if_available<const GraphList*>(
-      &from);
-  if (source == NULL) {
-    ::google::protobuf::internal::ReflectionOps::Merge(from, this);
-  } else {
-    MergeFrom(*source);
-  }
-}
-
-void GraphList::MergeFrom(const GraphList& from) {
-  GOOGLE_CHECK_NE(&from, this);
-  name_.MergeFrom(from.name_);
-  mutable_unknown_fields()->MergeFrom(from.unknown_fields());
-}
-
-void GraphList::CopyFrom(const ::google::protobuf::Message& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void GraphList::CopyFrom(const GraphList& from) {
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool GraphList::IsInitialized() const {
-
-  return true;
-}
-
-void GraphList::Swap(GraphList* other) {
-  if (other != this) {
-    name_.Swap(&other->name_);
-    std::swap(_has_bits_[0], other->_has_bits_[0]);
-    _unknown_fields_.Swap(&other->_unknown_fields_);
-    std::swap(_cached_size_, other->_cached_size_);
-  }
-}
-
-::google::protobuf::Metadata GraphList::GetMetadata() const {
-  protobuf_AssignDescriptorsOnce();
-  ::google::protobuf::Metadata metadata;
-  metadata.descriptor = GraphList_descriptor_;
-  metadata.reflection = GraphList_reflection_;
-  return metadata;
-}
-
-
-// @@protoc_insertion_point(namespace_scope)
-
-}  // namespace db
-}  // namespace range
-
-// @@protoc_insertion_point(global_scope)
@@ -0,0 +1,223 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstdio>
+
+#include <boost/make_shared.hpp>
+
+#include "head_node.h"
+
+namespace range { namespace db {
+
+typedef GraphInstanceInterface::record_type record_type;
+
+//##############################################################################
+//##############################################################################
+static inline bool
+has_version(const google::protobuf::RepeatedField<uint64_t> &versions, uint64_t version)
+{
+    for (int i = versions.size() - 1; i >= 0; --i) {
+        if (versions.Get(i) == version) {
+            return true;
+        }
+        if (versions.Get(i) < version) {
+            break;
+        }
+    }
+    return false;
+}
+
+//##############################################################################
+// Drop whatever isn't part of the list_version, and the older versions of
+// what is; leaving what ProtobufNode would read at list_version unchanged.
+//##############################################################################
+static void
+trim_to_head(NodeInfo &info)
+{
+    uint64_t list_version = info.list_version();
+
+    for (auto direction : { info.mutable_forward(), info.mutable_reverse() }) {
+        google::protobuf::RepeatedPtrField<NodeInfo_Adjacency> kept;
+        for (auto &edge : direction->edges()) {
+            if (has_version(edge.versions(), list_version)) {
+                auto e = kept.Add();
+                e->set_id(edge.id());
+                e->add_versions(list_version);
+            }
+        }
+        direction->mutable_edges()->Swap(&kept);
+    }
+
+    google::protobuf::RepeatedPtrField<NodeInfo_Tags_KeyValue> kept;
+    for (auto &key : info.tags().keys()) {
+        if (!has_version(key.versions(), list_version)) {
+            continue;
+        }
+        int vmap_idx;
+        for (vmap_idx = key.versionmap_size() - 1; vmap_idx >= 0; --vmap_idx) {
+            if (key.versionmap(vmap_idx).list_version() == list_version) {
+                break;
+            }
+        }
+        if (vmap_idx < 0) {
+            continue;
+        }
+        uint64_t key_version = key.versionmap(vmap_idx).key_version();
+
+        auto k = kept.Add();
+        k->set_key(key.key());
+        k->set_key_version(key.key_version());                                 // the counter update_tag() carries on from
+        k->add_versions(list_version);
+        *k->add_versionmap() = key.versionmap(vmap_idx);
+        for (auto &value : key.values()) {
+            if (has_version(value.versions(), key_version)) {
+                auto v = k->add_values();
+                v->set_data(value.data());
+                v->add_versions(key_version);
+            }
+        }
+    }
+    info.mutable_tags()->mutable_keys()->Swap(&kept);
+    info.set_head_only(true);
+}
+
+//##############################################################################
+//##############################################################################
+std::string
+HeadNode::history_key(const std::string &name, uint64_t version)
+{
+    char buf[24];
+    std::snprintf(buf, sizeof(buf), "%020llu", static_cast<unsigned long long>(version));   // so they sort by version
+    return name + '\a' + buf;
+}
+
+//##############################################################################
+//##############################################################################
+std::string
+HeadNode::history_base_key(const std::string &name)
+{
+    return name + '\a' + "base";
+}
+
+//##############################################################################
+// Only the lists are versioned; the header always comes from the head
+//##############################################################################
+const NodeInfo*
+HeadNode::history() const
+{
+    if (wanted_version_ == static_cast<uint64_t>(-1)) {
+        return nullptr;
+    }
+    const NodeInfo &head = node_header();
+    if (!head.head_only() || wanted_version_ >= head.list_version()) {
+        return nullptr;
+    }
+    if (history_version_ == wanted_version_) {
+        return &history_;
+    }
+
+    BOOST_LOG_FUNCTION();
+    history_version_ = wanted_version_;
+    for (auto &key : { history_key(name_, wanted_version_), history_base_key(name_) }) {
+        std::string buf = instance_->get_record(record_type::NODE_HISTORY, key);
+        if (!buf.empty() && NodeRecord::decode(buf, &history_)) {
+            return &history_;
+        }
+        history_.Clear();
+    }
+    LOG(debug5, "no_history") << name_ << ": " << wanted_version_;          // e.g. the version before it was first written
+    return &history_;
+}
+
+//##############################################################################
+//##############################################################################
+const NodeInfo_Tags&
+HeadNode::node_tags() const
+{
+    const NodeInfo *h = history();
+    return h ? h->tags() : ProtobufNode::node_tags();
+}
+
+//##############################################################################
+//##############################################################################
+const NodeInfo_Edges&
+HeadNode::node_forward() const
+{
+    const NodeInfo *h = history();
+    return h ? h->forward() : ProtobufNode::node_forward();
+}
+
+//##############################################################################
+//##############################################################################
+const NodeInfo_Edges&
+HeadNode::node_reverse() const
+{
+    const NodeInfo *h = history();
+    return h ? h->reverse() : ProtobufNode::node_reverse();
+}
+
+//##############################################################################
+// Archive the record we're replacing if it holds a version the new one won't;
+// before writing the new one, so that no version is ever in neither.
+//##############################################################################
+bool
+HeadNode::write_info()
+{
+    RANGE_LOG_TIMED_FUNCTION() << name_;
+    std::string previous = instance_->get_record(rectype, name_);
+    if (!previous.empty()) {
+        NodeRecord record { std::string(previous) };
+        if (record.valid()) {
+            const NodeInfo &prev = record.header();
+            if (!prev.head_only()) {
+                LOG(debug5, "archiving_full_history") << name_ << ": " << prev.list_version();
+                if (!instance_->write_record(record_type::NODE_HISTORY,
+                            history_base_key(name_), prev.list_version(), previous)) {
+                    LOG(error, "archive_failed") << name_;
+                    return false;
+                }
+            }
+            else if (prev.list_version() < info.list_version()) {
+                if (!instance_->write_record(record_type::NODE_HISTORY,
+                            history_key(name_, prev.list_version()), prev.list_version(), previous)) {
+                    LOG(error, "archive_failed") << name_ << ": " << prev.list_version();
+                    return false;
+                }
+            }
+        }
+    }
+
+    trim_to_head(info);
+    return ProtobufNode::write_info();
+}
+
+//##############################################################################
+//##############################################################################
+bool
+HeadNode::needs_rewrite(const std::string &record) const
+{
+    return ProtobufNode::needs_rewrite(record) || !NodeRecord(std::string(record)).header().head_only();
+}
+
+//##############################################################################
+//##############################################################################
+HeadNode::node_t
+HeadNode::make_node(const std::string &name) const
+{
+    return boost::make_shared<HeadNode>(name, instance_, wanted_version_);
+}
+
+} /* namespace db */ } /* namespace range */
@@ -0,0 +1,93 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _RANGE_DB_HEAD_NODE_H
+#define _RANGE_DB_HEAD_NODE_H
+
+#include <string>
+
+#include "pbuff_node.h"
+
+namespace range { namespace db {
+
+//##############################################################################
+/// A ProtobufNode whose NODE record only holds the edges and tags of its
+/// current list_version (NodeInfo.head_only), so that the record read for
+/// every query stays the size of the node rather than of its history.
+///
+/// Each time the list_version moves on, the record being replaced is
+/// appended unchanged as a NODE_HISTORY record under history_key(); reading
+/// an older wanted version loads that one record.  A record written before
+/// the split (still holding its whole history) is archived once under
+/// history_base_key() the first time it is rewritten, and answers for every
+/// version up to its own.
+///
+/// Reads any record a ProtobufNode writes, so a graph migrates node by node
+/// as they are written.
+class HeadNode : public ProtobufNode {
+    public:
+        //######################################################################
+        inline HeadNode()
+            : ProtobufNode(), history_(), history_version_(-1)
+        {
+        }
+
+        inline HeadNode(const std::string& name, instance_t instance,
+                        uint64_t version = -1)
+            : ProtobufNode(name, instance, version), history_(), history_version_(-1)
+        {
+        }
+
+        inline HeadNode(const std::string& name, instance_t instance,
+                        std::string&& record, uint64_t version = -1)
+            : ProtobufNode(name, instance, std::move(record), version),
+                history_(), history_version_(-1)
+        {
+        }
+
+        //######################################################################
+        /// @return NODE_HISTORY key of name's record at list_version version
+        static std::string history_key(const std::string &name, uint64_t version);
+
+        //######################################################################
+        /// @return NODE_HISTORY key of name's record from before the split
+        static std::string history_base_key(const std::string &name);
+
+    //##########################################################################
+    //##########################################################################
+    protected:
+        virtual const NodeInfo_Tags& node_tags() const override;
+        virtual const NodeInfo_Edges& node_forward() const override;
+        virtual const NodeInfo_Edges& node_reverse() const override;
+        virtual bool write_info() override;
+        virtual bool needs_rewrite(const std::string &record) const override;
+        virtual node_t make_node(const std::string &name) const override;
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        mutable NodeInfo history_;                                              ///< record for wanted_version_, if older than the head
+        mutable uint64_t history_version_;                                      ///< wanted version history_ was loaded for, or -1
+
+        //######################################################################
+        /// @return the record holding wanted_version_ (empty if there is
+        ///         none; the node had nothing then), or nullptr for the head
+        const NodeInfo* history() const;
+};
+
+} /* namespace db */ } /* namespace range */
+
+#endif
@@ -0,0 +1,91 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _RANGE_DB_LIVE_INTERVALS_H
+#define _RANGE_DB_LIVE_INTERVALS_H
+
+#include <cstdint>
+
+#include "nodeinfo.pb.h"
+
+namespace range { namespace db {
+
+//##############################################################################
+/// Helpers for the repeated [first, last) graph version intervals kept by the
+/// secondary indexes; Entry is any message with a `repeated
+/// NodeInfo.Interval live` field.
+//##############################################################################
+
+typedef google::protobuf::RepeatedPtrField<NodeInfo_Interval> intervals_t;
+
+//##############################################################################
+/// @return true if version falls in one of live's intervals
+inline bool
+intervals_live_at(const intervals_t &live, uint64_t version)
+{
+    for (int i = live.size() - 1; i >= 0; --i) {
+        if (version >= live.Get(i).first()) {
+            return !live.Get(i).has_last() || version < live.Get(i).last();
+        }
+    }
+    return false;
+}
+
+//##############################################################################
+/// Start an interval at version, unless one is already open
+///
+/// @return true if entry changed
+template <typename Entry>
+inline bool
+open_interval(Entry *entry, uint64_t version)
+{
+    int n = entry->live_size();
+    if (n > 0 && !entry->live(n - 1).has_last()) {
+        return false;
+    }
+    if (n > 0 && entry->live(n - 1).last() == version) {                        // removed and re-added in consecutive versions
+        entry->mutable_live(n - 1)->clear_last();
+    }
+    else {
+        entry->add_live()->set_first(version);
+    }
+    return true;
+}
+
+//##############################################################################
+/// End the open interval (if any) at version
+///
+/// @return true if entry changed
+template <typename Entry>
+inline bool
+close_interval(Entry *entry, uint64_t version)
+{
+    int n = entry->live_size();
+    if (n == 0 || entry->live(n - 1).has_last()) {
+        return false;
+    }
+    if (entry->live(n - 1).first() >= version) {                                // added and removed in the same version
+        entry->mutable_live()->RemoveLast();
+    }
+    else {
+        entry->mutable_live(n - 1)->set_last(version);
+    }
+    return true;
+}
+
+} /* namespace db */ } /* namespace range */
+
+#endif
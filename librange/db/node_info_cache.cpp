@@ -0,0 +1,193 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <functional>
+
+#include "node_info_cache.h"
+
+namespace range { namespace db {
+
+static ::range::EmitterModuleRegistration NodeInfoCacheLogModule { "db.NodeInfoCache" };
+
+//##############################################################################
+//##############################################################################
+boost::shared_ptr<NodeInfoCache>
+NodeInfoCache::get()
+{
+    static boost::shared_ptr<NodeInfoCache> inst { new NodeInfoCache() };       // magic static; this sits on the read path, so no mutex
+    return inst;
+}
+
+//##############################################################################
+//##############################################################################
+NodeInfoCache::NodeInfoCache()
+    : capacity_(65536), hits_(0), misses_(0), evictions_(0),
+    log(NodeInfoCacheLogModule)
+{
+}
+
+//##############################################################################
+//##############################################################################
+std::string
+NodeInfoCache::cache_key(const std::string &graph, const std::string &name)
+{
+    std::string key;
+    key.reserve(graph.size() + name.size() + 1);
+    key.append(graph);
+    key.push_back('\0');
+    key.append(name);
+    return key;
+}
+
+//##############################################################################
+//##############################################################################
+NodeInfoCache::shard_t&
+NodeInfoCache::shard_for(const std::string &key)
+{
+    return shards_[std::hash<std::string>()(key) % n_shards_];
+}
+
+//##############################################################################
+//##############################################################################
+size_t
+NodeInfoCache::shard_capacity() const
+{
+    size_t cap = capacity_.load();
+    if(cap == 0) {
+        return 0;
+    }
+    return (cap + n_shards_ - 1) / n_shards_;
+}
+
+//##############################################################################
+// MUST HOLD shard.lock
+//##############################################################################
+void
+NodeInfoCache::evict(shard_t &shard, size_t max_entries)
+{
+    uint64_t n_evicted = 0;
+    while(shard.lru.size() > max_entries) {
+        shard.index.erase(shard.lru.back().key);
+        shard.lru.pop_back();
+        ++n_evicted;
+    }
+    if(n_evicted > 0) {
+        evictions_ += n_evicted;
+        log.count("eviction", n_evicted);
+    }
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeInfoCache::clear()
+{
+    RANGE_LOG_FUNCTION();
+    for(auto &shard : shards_) {
+        std::lock_guard<std::mutex> guard { shard.lock };
+        shard.index.clear();
+        shard.lru.clear();
+    }
+    log.count("clear", 1);
+}
+
+//##############################################################################
+//##############################################################################
+NodeInfoCache::info_t
+NodeInfoCache::lookup(const std::string &graph, const std::string &name,
+        uint64_t generation)
+{
+    if(generation == 0 || capacity_.load() == 0) {
+        return nullptr;
+    }
+
+    std::string key = cache_key(graph, name);
+    shard_t &shard = shard_for(key);
+    {
+        std::lock_guard<std::mutex> guard { shard.lock };
+        auto it = shard.index.find(key);
+        if(it != shard.index.end() && it->second->generation == generation) {
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);         // move to front
+            ++hits_;
+            log.count("hit", 1);
+            return it->second->info;
+        }
+    }
+    ++misses_;
+    log.count("miss", 1);
+    return nullptr;
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeInfoCache::insert(const std::string &graph, const std::string &name,
+        uint64_t generation, info_t info)
+{
+    size_t max_entries = shard_capacity();
+    if(!info || generation == 0 || max_entries == 0) {
+        return;
+    }
+
+    std::string key = cache_key(graph, name);
+    shard_t &shard = shard_for(key);
+
+    std::lock_guard<std::mutex> guard { shard.lock };
+    auto it = shard.index.find(key);
+    if(it != shard.index.end()) {
+        if(it->second->generation > generation) {                               // a reader on an older snapshot mustn't
+            return;                                                             // push out what newer ones share
+        }
+        it->second->generation = generation;
+        it->second->info = info;
+        shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+        return;
+    }
+
+    shard.lru.push_front(entry_t { key, generation, info });
+    shard.index[key] = shard.lru.begin();
+    evict(shard, max_entries);
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeInfoCache::set_capacity(size_t capacity)
+{
+    RANGE_LOG_FUNCTION();
+    capacity_ = capacity;
+    size_t max_entries = shard_capacity();
+    for(auto &shard : shards_) {
+        std::lock_guard<std::mutex> guard { shard.lock };
+        evict(shard, max_entries);
+    }
+    log.gauge("capacity", capacity);
+}
+
+//##############################################################################
+//##############################################################################
+size_t
+NodeInfoCache::size() const
+{
+    size_t n = 0;
+    for(auto &shard : shards_) {
+        std::lock_guard<std::mutex> guard { shard.lock };
+        n += shard.lru.size();
+    }
+    return n;
+}
+
+} /* namespace db */ } /* namespace range */
@@ -0,0 +1,117 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _RANGE_DB_NODE_INFO_CACHE_H
+#define _RANGE_DB_NODE_INFO_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <boost/shared_ptr.hpp>
+
+#include "../core/log.h"
+
+#include "node_record.h"
+
+namespace range { namespace db {
+
+//##############################################################################
+/// Process-wide cache of node records, shared by every graph
+/// instance (and therefore every RangeAPI_v1) in the process.
+///
+/// Entries are keyed by (graph, node name) and tagged with the generation of
+/// the snapshot they were read in: the graph version committed as of that
+/// snapshot (plus one), as read from the database. Every write to a node
+/// commits a new graph version, whichever process makes it, so an entry read
+/// before the write simply stops matching and ages out of the LRU.
+/// A generation of 0 means "do not cache".
+class NodeInfoCache {
+    public:
+        typedef boost::shared_ptr<const NodeRecord> info_t;                     ///< decoded as its readers need it
+
+        static boost::shared_ptr<NodeInfoCache> get();
+
+        //######################################################################
+        /// Drop all entries. Called when the environment they were read from
+        /// is closed.
+        void clear();
+
+        //######################################################################
+        /// @param[in] graph name of the graph instance
+        /// @param[in] name name of the node
+        /// @param[in] generation generation of the reader's snapshot
+        /// @return record, or nullptr on a miss
+        info_t lookup(const std::string &graph, const std::string &name,
+                uint64_t generation);
+
+        //######################################################################
+        /// Replaces an entry from an older generation; one from a newer
+        /// generation is kept, and info silently dropped
+        ///
+        /// @param[in] graph name of the graph instance
+        /// @param[in] name name of the node
+        /// @param[in] generation generation of the snapshot the record was read in
+        /// @param[in] info record
+        void insert(const std::string &graph, const std::string &name,
+                uint64_t generation, info_t info);
+
+        //######################################################################
+        /// @param[in] capacity maximum number of entries (0 disables the cache)
+        void set_capacity(size_t capacity);
+        size_t capacity() const { return capacity_.load(); }
+        size_t size() const;
+
+        uint64_t hits() const { return hits_.load(); }
+        uint64_t misses() const { return misses_.load(); }
+        uint64_t evictions() const { return evictions_.load(); }
+
+    private:
+        NodeInfoCache();
+
+        struct entry_t {
+            std::string key;
+            uint64_t generation;
+            info_t info;
+        };
+
+        struct shard_t {
+            std::mutex lock;
+            std::list<entry_t> lru;
+            std::unordered_map<std::string, std::list<entry_t>::iterator> index;
+        };
+
+        static const size_t n_shards_ = 16;
+
+        static std::string cache_key(const std::string &graph, const std::string &name);
+        shard_t& shard_for(const std::string &key);
+        size_t shard_capacity() const;
+        void evict(shard_t &shard, size_t max_entries);
+
+        mutable std::array<shard_t, n_shards_> shards_;
+        std::atomic<size_t> capacity_;
+        std::atomic<uint64_t> hits_;
+        std::atomic<uint64_t> misses_;
+        std::atomic<uint64_t> evictions_;
+        range::Emitter log;
+};
+
+} /* namespace db */ } /* namespace range */
+
+#endif
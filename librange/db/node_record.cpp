@@ -0,0 +1,254 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <cstring>
+
+#include "node_record.h"
+
+namespace range { namespace db {
+
+const char NodeRecord::magic[4] = { '\0', 'R', 'N', 'S' };
+const uint8_t NodeRecord::layout_version;
+const size_t NodeRecord::toc_size;
+
+//##############################################################################
+//##############################################################################
+static inline void
+put_uint32(std::string &buf, size_t pos, uint32_t v)
+{
+    for (int i = 0; i < 4; ++i) {
+        buf[pos + i] = static_cast<char>((v >> (8 * i)) & 0xff);
+    }
+}
+
+//##############################################################################
+//##############################################################################
+static inline uint32_t
+get_uint32(const std::string &buf, size_t pos)
+{
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i) {
+        v |= static_cast<uint32_t>(static_cast<unsigned char>(buf[pos + i])) << (8 * i);
+    }
+    return v;
+}
+
+//##############################################################################
+//##############################################################################
+NodeRecord::NodeRecord(std::string &&buffer)
+    : buffer_(std::move(buffer)), encoding_(encoding_of(buffer_)), toc_valid_(false)
+{
+    for (int s = 0; s < N_SECTIONS; ++s) {
+        offsets_[s] = lengths_[s] = 0;
+        parsed_[s] = false;
+    }
+    if (encoding_ == node_encoding::SECTIONED) {
+        toc_valid_ = read_toc(buffer_, offsets_, lengths_);
+    }
+}
+
+//##############################################################################
+//##############################################################################
+NodeRecord::node_encoding
+NodeRecord::encoding_of(const std::string &buffer)
+{
+    if (buffer.size() > sizeof(magic) && std::memcmp(buffer.data(), magic, sizeof(magic)) == 0) {
+        return node_encoding::SECTIONED;
+    }
+    return node_encoding::PROTOBUF;
+}
+
+//##############################################################################
+//##############################################################################
+bool
+NodeRecord::read_toc(const std::string &buffer, uint32_t *offsets, uint32_t *lengths)
+{
+    if (buffer.size() < toc_size || static_cast<uint8_t>(buffer[4]) != layout_version) {
+        return false;
+    }
+    for (int s = 0; s < N_SECTIONS; ++s) {
+        offsets[s] = get_uint32(buffer, 5 + s * 8);
+        lengths[s] = get_uint32(buffer, 9 + s * 8);
+        if (offsets[s] < toc_size || offsets[s] > buffer.size()
+                || lengths[s] > buffer.size() - offsets[s]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//##############################################################################
+//##############################################################################
+std::string
+NodeRecord::encode(NodeInfo &info, node_encoding encoding)
+{
+    if (encoding != node_encoding::SECTIONED) {
+        return info.SerializeAsString();
+    }
+
+    NodeInfo_Tags tags;
+    NodeInfo_Edges forward, reverse;
+    tags.Swap(info.mutable_tags());
+    forward.Swap(info.mutable_forward());
+    reverse.Swap(info.mutable_reverse());
+
+    std::string sections[N_SECTIONS];
+    sections[HEADER] = info.SerializeAsString();                                // with empty sections, so it parses alone
+    sections[TAGS] = tags.SerializeAsString();
+    sections[FORWARD] = forward.SerializeAsString();
+    sections[REVERSE] = reverse.SerializeAsString();
+
+    tags.Swap(info.mutable_tags());
+    forward.Swap(info.mutable_forward());
+    reverse.Swap(info.mutable_reverse());
+
+    size_t size = toc_size;
+    for (auto &section : sections) {
+        size += section.size();
+    }
+    std::string buf(toc_size, '\0');
+    buf.reserve(size);
+    buf.replace(0, sizeof(magic), magic, sizeof(magic));
+    buf[4] = static_cast<char>(layout_version);
+    for (int s = 0; s < N_SECTIONS; ++s) {
+        put_uint32(buf, 5 + s * 8, static_cast<uint32_t>(buf.size()));
+        put_uint32(buf, 9 + s * 8, static_cast<uint32_t>(sections[s].size()));
+        buf.append(sections[s]);
+    }
+    return buf;
+}
+
+//##############################################################################
+//##############################################################################
+bool
+NodeRecord::decode(const std::string &buffer, NodeInfo *info)
+{
+    if (encoding_of(buffer) != node_encoding::SECTIONED) {
+        return info->ParseFromString(buffer);
+    }
+
+    uint32_t offsets[N_SECTIONS], lengths[N_SECTIONS];
+    if (!read_toc(buffer, offsets, lengths)) {
+        info->Clear();
+        return false;
+    }
+    const char * data = buffer.data();
+    return info->ParseFromArray(data + offsets[HEADER], lengths[HEADER])
+        && info->mutable_tags()->ParseFromArray(data + offsets[TAGS], lengths[TAGS])
+        && info->mutable_forward()->ParseFromArray(data + offsets[FORWARD], lengths[FORWARD])
+        && info->mutable_reverse()->ParseFromArray(data + offsets[REVERSE], lengths[REVERSE]);
+}
+
+//##############################################################################
+// Only ever called once per section, under its once_flag
+//##############################################################################
+void
+NodeRecord::parse(section s) const
+{
+    if (encoding_ == node_encoding::PROTOBUF) {
+        parsed_[s] = !buffer_.empty() && info_.ParseFromString(buffer_);          // empty: a new node
+        std::string().swap(buffer_);
+        return;
+    }
+    if (!toc_valid_) {
+        return;
+    }
+    switch (s) {
+        case HEADER:
+            parsed_[s] = info_.ParseFromArray(section_data(s), lengths_[s]);
+            break;
+        case TAGS:
+            parsed_[s] = tags_.ParseFromArray(section_data(s), lengths_[s]);
+            break;
+        case FORWARD:
+            parsed_[s] = forward_.ParseFromArray(section_data(s), lengths_[s]);
+            break;
+        case REVERSE:
+            parsed_[s] = reverse_.ParseFromArray(section_data(s), lengths_[s]);
+            break;
+        default:
+            break;
+    }
+}
+
+//##############################################################################
+//##############################################################################
+bool
+NodeRecord::valid() const
+{
+    header();
+    return parsed_[HEADER] && info_.IsInitialized();
+}
+
+//##############################################################################
+//##############################################################################
+const NodeInfo&
+NodeRecord::header() const
+{
+    std::call_once(once_[HEADER], &NodeRecord::parse, this, HEADER);
+    return info_;
+}
+
+//##############################################################################
+//##############################################################################
+const NodeInfo_Tags&
+NodeRecord::tags() const
+{
+    if (encoding_ == node_encoding::PROTOBUF) {
+        return header().tags();
+    }
+    std::call_once(once_[TAGS], &NodeRecord::parse, this, TAGS);
+    return tags_;
+}
+
+//##############################################################################
+//##############################################################################
+const NodeInfo_Edges&
+NodeRecord::forward() const
+{
+    if (encoding_ == node_encoding::PROTOBUF) {
+        return header().forward();
+    }
+    std::call_once(once_[FORWARD], &NodeRecord::parse, this, FORWARD);
+    return forward_;
+}
+
+//##############################################################################
+//##############################################################################
+const NodeInfo_Edges&
+NodeRecord::reverse() const
+{
+    if (encoding_ == node_encoding::PROTOBUF) {
+        return header().reverse();
+    }
+    std::call_once(once_[REVERSE], &NodeRecord::parse, this, REVERSE);
+    return reverse_;
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeRecord::decode(NodeInfo *info) const
+{
+    info->CopyFrom(header());
+    if (encoding_ == node_encoding::SECTIONED) {
+        info->mutable_tags()->CopyFrom(tags());
+        info->mutable_forward()->CopyFrom(forward());
+        info->mutable_reverse()->CopyFrom(reverse());
+    }
+}
+
+} /* namespace db */ } /* namespace range */
@@ -0,0 +1,123 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _RANGE_DB_NODE_RECORD_H
+#define _RANGE_DB_NODE_RECORD_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+#include "nodeinfo.pb.h"
+#include "db_interface.h"
+
+namespace range { namespace db {
+
+//##############################################################################
+/// A node record as read from the instance, decoded on demand.
+///
+/// Records come in two encodings (see GraphInstanceInterface::node_encoding):
+///
+///  - PROTOBUF: a serialized NodeInfo; the first access decodes all of it.
+///  - SECTIONED: a table of contents followed by four separately serialized
+///    sections: the NodeInfo scalars and live intervals (the "header"), its
+///    Tags, and its forward and reverse Edges. Each section is decoded the
+///    first time it is asked for, so reading a tag from a cluster with
+///    thousands of children never decodes its edges.
+///
+///        0   '\0' 'R' 'N' 'S'     magic; a serialized NodeInfo can't start with 0
+///        4   uint8                layout version (1)
+///        5   4 x (uint32, uint32) offset and length of each section,
+///                                 little-endian, in section order
+///        37  section data
+///
+/// Readers tell the encodings apart by the magic, so a graph can hold both
+/// while it is being converted. Safe to share between threads once built.
+class NodeRecord {
+    public:
+        typedef GraphInstanceInterface::node_encoding node_encoding;
+
+        //######################################################################
+        /// @param[in] buffer record as read from the instance; may be empty
+        explicit NodeRecord(std::string &&buffer);
+
+        NodeRecord(const NodeRecord&) = delete;
+        NodeRecord& operator=(const NodeRecord&) = delete;
+
+        //######################################################################
+        /// @param[in,out] info node to encode; its sections are moved out
+        ///                 while they are serialized, and back again
+        /// @return the record for info, in encoding
+        static std::string encode(NodeInfo &info, node_encoding encoding);
+
+        //######################################################################
+        /// Decode all of buffer into info, e.g. for a writer about to change
+        /// it. As NodeInfo::ParseFromString, info is left partial on failure.
+        ///
+        /// @return false if buffer isn't a complete record
+        static bool decode(const std::string &buffer, NodeInfo *info);
+
+        //######################################################################
+        static node_encoding encoding_of(const std::string &buffer);
+        node_encoding encoding() const { return encoding_; }
+
+        //######################################################################
+        /// @return false for an empty (new node) or corrupt record
+        bool valid() const;
+
+        //######################################################################
+        /// NodeInfo scalars and graph versions; for PROTOBUF records, all of
+        /// NodeInfo. Only fields outside tags, forward and reverse may be used.
+        const NodeInfo& header() const;
+        const NodeInfo_Tags& tags() const;
+        const NodeInfo_Edges& forward() const;
+        const NodeInfo_Edges& reverse() const;
+
+        //######################################################################
+        /// Copy all of the record into info
+        void decode(NodeInfo *info) const;
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        enum section { HEADER = 0, TAGS, FORWARD, REVERSE, N_SECTIONS };
+
+        static const char magic[4];
+        static const uint8_t layout_version = 1;
+        static const size_t toc_size = 5 + N_SECTIONS * 8;
+
+        mutable std::string buffer_;                                            ///< released once a PROTOBUF record is decoded
+        node_encoding encoding_;
+        bool toc_valid_;
+        uint32_t offsets_[N_SECTIONS];
+        uint32_t lengths_[N_SECTIONS];
+
+        mutable std::once_flag once_[N_SECTIONS];
+        mutable bool parsed_[N_SECTIONS];
+        mutable NodeInfo info_;                                                 ///< PROTOBUF: all of it; SECTIONED: the header section
+        mutable NodeInfo_Tags tags_;
+        mutable NodeInfo_Edges forward_;
+        mutable NodeInfo_Edges reverse_;
+
+        //######################################################################
+        static bool read_toc(const std::string &buffer, uint32_t *offsets, uint32_t *lengths);
+        void parse(section s) const;
+        const char * section_data(section s) const { return buffer_.data() + offsets_[s]; }
+};
+
+} /* namespace db */ } /* namespace range */
+
+#endif
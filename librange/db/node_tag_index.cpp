@@ -0,0 +1,243 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cstdlib>
+
+#include "node_tag_index.h"
+#include "live_intervals.h"
+
+namespace range { namespace db {
+
+typedef GraphInstanceInterface::record_type record_type;
+
+::range::EmitterModuleRegistration NodeTagIndexLogModule { "db.NodeTagIndex" };
+const uint32_t NodeTagIndex::min_shards;
+const int NodeTagIndex::max_shard_entries;
+const uint32_t NodeTagIndex::format_version;
+
+//##############################################################################
+// Terminated, so no group reads as another's "<group>:<n>" record
+//##############################################################################
+std::string
+NodeTagIndex::group(const std::string &key, const std::string &value)
+{
+    std::string tag { key };
+    tag.push_back('\0');
+    tag.append(value);
+    tag.push_back('\0');
+    return tag;
+}
+
+//##############################################################################
+//##############################################################################
+std::string
+NodeTagIndex::prefix(uint64_t epoch)
+{
+    return "tag_index:" + std::to_string(static_cast<unsigned long long>(epoch)) + ":";
+}
+
+//##############################################################################
+//##############################################################################
+uint64_t
+NodeTagIndex::epoch() const
+{
+    if (static_cast<int64_t>(epoch_) == -1) {
+        std::string buf = instance_->get_record(record_type::GRAPH_META, "tag_index_epoch");
+        epoch_ = buf.empty() ? 0 : std::strtoull(buf.c_str(), nullptr, 10);
+    }
+    return epoch_;
+}
+
+//##############################################################################
+//##############################################################################
+NodeTagIndex::records_t&
+NodeTagIndex::records() const
+{
+    if (!records_) {
+        records_.reset(new records_t { instance_, prefix(epoch()),
+                min_shards, max_shard_entries, format_version, NodeTagIndexLogModule });
+    }
+    return *records_;
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeTagIndex::open(const std::string &name, const std::string &key,
+        const std::string &value, uint64_t version)
+{
+    std::string tag = group(key, value);
+    if (open_interval(records().insert(tag, name), version)) {
+        records().changed(tag, name);
+    }
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeTagIndex::close(const std::string &name, const std::string &key,
+        const std::string &value, uint64_t version)
+{
+    std::string tag = group(key, value);
+    if (!records().find(tag, name)) {
+        return;
+    }
+    TagIndexShard_Entry *entry = records().insert(tag, name);
+    if (!close_interval(entry, version)) {
+        return;
+    }
+    if (entry->live_size() == 0) {                                              // never really had the tag in the graph
+        records().erase(tag, name);
+    }
+    records().changed(tag, name);
+}
+
+//##############################################################################
+// Mirrors ProtobufNode::add_graph_version()
+//##############################################################################
+void
+NodeTagIndex::add_node(const std::string &name, const tags_t &tags, uint64_t version)
+{
+    RANGE_LOG_TIMED_FUNCTION() << name << ": " << version;
+    auto lock = instance_->write_lock(record_type::NODE_META, "");
+    add_tags(name, tags, version);
+    flush();
+}
+
+//##############################################################################
+// Mirrors ProtobufNode::remove_graph_version()
+//##############################################################################
+void
+NodeTagIndex::remove_node(const std::string &name, const tags_t &tags, uint64_t version)
+{
+    RANGE_LOG_TIMED_FUNCTION() << name << ": " << version;
+    auto lock = instance_->write_lock(record_type::NODE_META, "");
+    for (auto &tag : tags) {
+        for (auto &value : tag.second) {
+            close(name, tag.first, value, version);
+        }
+    }
+    flush();
+}
+
+//##############################################################################
+// Mirrors ProtobufNode::update_tag()
+//##############################################################################
+void
+NodeTagIndex::update(const std::string &name, const std::string &key,
+        const std::vector<std::string> &old_values,
+        const std::vector<std::string> &new_values, uint64_t version)
+{
+    RANGE_LOG_TIMED_FUNCTION() << name << ": " << key << ": " << version;
+    auto lock = instance_->write_lock(record_type::NODE_META, "");
+    for (auto &value : old_values) {
+        if (std::find(new_values.begin(), new_values.end(), value) == new_values.end()) {
+            close(name, key, value, version);
+        }
+    }
+    for (auto &value : new_values) {
+        if (std::find(old_values.begin(), old_values.end(), value) == old_values.end()) {
+            open(name, key, value, version);
+        }
+    }
+    flush();
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeTagIndex::add_tags(const std::string &name, const tags_t &tags, uint64_t version)
+{
+    BOOST_LOG_FUNCTION();
+    for (auto &tag : tags) {
+        for (auto &value : tag.second) {
+            open(name, tag.first, value, version);
+        }
+    }
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeTagIndex::clear()
+{
+    BOOST_LOG_FUNCTION();
+    auto lock = instance_->write_lock(record_type::NODE_META, "");
+    size_t removed = instance_->remove_records(record_type::NODE_META, prefix(epoch()));
+    LOG(debug1, "cleared_tag_index") << epoch() << ": " << removed << " records";
+    epoch_ = epoch() + 1;
+    epoch_dirty_ = true;
+    records_.reset();
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeTagIndex::flush()
+{
+    BOOST_LOG_FUNCTION();
+    auto lock = instance_->write_lock(record_type::NODE_META, "");
+    if (epoch_dirty_) {
+        instance_->write_record(record_type::GRAPH_META, "tag_index_epoch", 0,
+                std::to_string(static_cast<unsigned long long>(epoch_)));
+        epoch_dirty_ = false;
+    }
+    if (records_) {
+        records_->flush();
+    }
+}
+
+//##############################################################################
+//##############################################################################
+std::vector<std::string>
+NodeTagIndex::find(const std::string &key, const std::string &value, uint64_t version) const
+{
+    RANGE_LOG_TIMED_FUNCTION() << key << "=" << value << ": " << version;
+    std::vector<std::string> names;
+    records().for_each(group(key, value), [&](const TagIndexShard_Entry &entry) {
+        if (intervals_live_at(entry.live(), version)) {
+            names.push_back(entry.name());
+        }
+    });
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+//##############################################################################
+//##############################################################################
+uint64_t
+NodeTagIndex::complete_from() const
+{
+    BOOST_LOG_FUNCTION();
+    std::string buf = instance_->get_record(record_type::GRAPH_META, "tag_index");
+    if (buf.empty()) {
+        return -1;
+    }
+    return std::strtoull(buf.c_str(), nullptr, 10);
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeTagIndex::set_complete_from(uint64_t version)
+{
+    BOOST_LOG_FUNCTION();
+    instance_->write_record(record_type::GRAPH_META, "tag_index", 0,
+            std::to_string(static_cast<unsigned long long>(version)));
+}
+
+} /* namespace db */ } /* namespace range */
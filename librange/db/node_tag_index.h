@@ -0,0 +1,136 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _RANGE_DB_NODE_TAG_INDEX_H
+#define _RANGE_DB_NODE_TAG_INDEX_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "../core/log.h"
+
+#include "nodeinfo.pb.h"
+#include "db_interface.h"
+#include "sharded_index.h"
+
+namespace range { namespace db {
+
+extern ::range::EmitterModuleRegistration NodeTagIndexLogModule;
+//##############################################################################
+/// Inverted index from a tag (key, value) to the names of the nodes that have
+/// it, with the [first, last) graph versions each had it while part of the
+/// graph. Nodes outside the graph are not indexed.
+///
+/// Each tag's entries are ShardedIndexRecords of their own, spread by node
+/// name, so a lookup reads only that tag's records and a write rewrites one
+/// small record however many nodes share the tag. Records are named by the
+/// GRAPH_META "tag_index_epoch", which clear() moves on after deleting the
+/// old epoch's records; the set of tags can't be listed, so they're found by
+/// their common prefix instead.
+///
+/// Tag history is kept per node list_version, which can't be mapped back to
+/// graph versions; so the GRAPH_META "tag_index" record holds the first graph
+/// version the index is complete from (the version range_upgrade built it at,
+/// or 0 for graphs created with it, which BerkeleyDB::createGraphInstance
+/// records).
+class NodeTagIndex {
+    public:
+        typedef boost::shared_ptr<GraphInstanceInterface> instance_t;
+        typedef std::unordered_map<std::string, std::vector<std::string>> tags_t;
+
+        static const uint32_t min_shards = 1;                                   ///< per tag
+        static const int max_shard_entries = 512;
+        static const uint32_t format_version = 2;                               ///< TagIndexShard.format_version this writes
+
+        //######################################################################
+        explicit NodeTagIndex(instance_t instance)
+            : instance_(instance), epoch_(-1), epoch_dirty_(false), records_(),
+            log(NodeTagIndexLogModule)
+        {
+        }
+
+        //######################################################################
+        /// name became part of the graph at version, with tags
+        void add_node(const std::string &name, const tags_t &tags, uint64_t version);
+
+        //######################################################################
+        /// name is no longer part of the graph at version; tags are the ones
+        /// it had
+        void remove_node(const std::string &name, const tags_t &tags, uint64_t version);
+
+        //######################################################################
+        /// name's values for key went from old_values to new_values at version
+        void update(const std::string &name, const std::string &key,
+                const std::vector<std::string> &old_values,
+                const std::vector<std::string> &new_values, uint64_t version);
+
+        //######################################################################
+        /// Used to (re)build the index; held until flush()
+        void add_tags(const std::string &name, const tags_t &tags, uint64_t version);
+
+        //######################################################################
+        /// Empty the index; the old records are deleted with the current
+        /// transaction, the rest is held until flush()
+        void clear();
+
+        //######################################################################
+        /// Write out held changes
+        void flush();
+
+        //######################################################################
+        /// @param[in] version graph version, at least complete_from()
+        /// @return names of the nodes with value among key's values at
+        ///         version, in name order
+        std::vector<std::string> find(const std::string &key, const std::string &value,
+                uint64_t version) const;
+
+        //######################################################################
+        /// @return the records (key, value)'s entries are in
+        static std::string group(const std::string &key, const std::string &value);
+
+        //######################################################################
+        /// @return first graph version the index can answer for, or -1
+        uint64_t complete_from() const;
+        void set_complete_from(uint64_t version);
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        typedef ShardedIndexRecords<TagIndexShard, TagIndexShard_Entry> records_t;
+
+        instance_t instance_;
+        mutable uint64_t epoch_;                                                ///< -1 until read
+        bool epoch_dirty_;
+        mutable std::unique_ptr<records_t> records_;
+        range::Emitter log;
+
+        //######################################################################
+        static std::string prefix(uint64_t epoch);                              ///< of every record in epoch
+        uint64_t epoch() const;
+        records_t& records() const;
+        void open(const std::string &name, const std::string &key, const std::string &value,
+                uint64_t version);
+        void close(const std::string &name, const std::string &key, const std::string &value,
+                uint64_t version);
+};
+
+} /* namespace db */ } /* namespace range */
+
+#endif
@@ -0,0 +1,151 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <cstdlib>
+
+#include "node_type_index.h"
+#include "live_intervals.h"
+
+namespace range { namespace db {
+
+typedef GraphInstanceInterface::record_type record_type;
+
+::range::EmitterModuleRegistration NodeTypeIndexLogModule { "db.NodeTypeIndex" };
+const uint32_t NodeTypeIndex::min_shards;
+const int NodeTypeIndex::max_shard_entries;
+const uint32_t NodeTypeIndex::format_version;
+
+//##############################################################################
+//##############################################################################
+std::string
+NodeTypeIndex::group(node_type type)
+{
+    return std::to_string(static_cast<unsigned long long>(type));
+}
+
+//##############################################################################
+// Mirrors ProtobufNode::add_graph_version()
+//##############################################################################
+void
+NodeTypeIndex::add(node_type type, const std::string &name, uint64_t version)
+{
+    RANGE_LOG_TIMED_FUNCTION() << name << ": " << version;
+    auto lock = instance_->write_lock(record_type::NODE_META, "");
+    auto entry = records_.insert(group(type), name);
+    if (!open_interval(entry, version)) {
+        return;
+    }
+    records_.changed(group(type), name);
+    flush();
+}
+
+//##############################################################################
+// Mirrors ProtobufNode::remove_graph_version()
+//##############################################################################
+void
+NodeTypeIndex::remove(node_type type, const std::string &name, uint64_t version)
+{
+    RANGE_LOG_TIMED_FUNCTION() << name << ": " << version;
+    auto lock = instance_->write_lock(record_type::NODE_META, "");
+    if (!records_.find(group(type), name)) {
+        return;
+    }
+    auto entry = records_.insert(group(type), name);
+    if (!close_interval(entry, version)) {
+        return;
+    }
+    if (entry->live_size() == 0) {                                              // never really part of the graph
+        records_.erase(group(type), name);
+    }
+    records_.changed(group(type), name);
+    flush();
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeTypeIndex::add_intervals(node_type type, const std::string &name, const intervals_t &live)
+{
+    BOOST_LOG_FUNCTION();
+    if (live.size() == 0) {
+        return;
+    }
+    auto entry = records_.insert(group(type), name);
+    entry->mutable_live()->CopyFrom(live);
+    records_.changed(group(type), name);
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeTypeIndex::clear()
+{
+    BOOST_LOG_FUNCTION();
+    for (auto &type : graph::NodeIface::node_type_names) {
+        records_.clear(group(type.first));
+    }
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeTypeIndex::flush()
+{
+    BOOST_LOG_FUNCTION();
+    records_.flush();
+}
+
+//##############################################################################
+//##############################################################################
+std::vector<std::string>
+NodeTypeIndex::find(node_type type, uint64_t version) const
+{
+    RANGE_LOG_TIMED_FUNCTION() << graph::NodeIface::node_type_names.find(type)->second << ": " << version;
+    std::vector<std::string> names;
+    records_.for_each(group(type), [&](const TypeIndexShard_Entry &entry) {
+        if (intervals_live_at(entry.live(), version)) {
+            names.push_back(entry.name());
+        }
+    });
+    std::sort(names.begin(), names.end());
+    return names;
+}
+
+//##############################################################################
+//##############################################################################
+uint64_t
+NodeTypeIndex::complete_from() const
+{
+    BOOST_LOG_FUNCTION();
+    std::string buf = instance_->get_record(record_type::GRAPH_META, "type_index");
+    if (buf.empty()) {
+        return -1;
+    }
+    return std::strtoull(buf.c_str(), nullptr, 10);
+}
+
+//##############################################################################
+//##############################################################################
+void
+NodeTypeIndex::set_complete_from(uint64_t version)
+{
+    BOOST_LOG_FUNCTION();
+    instance_->write_record(record_type::GRAPH_META, "type_index", 0,
+            std::to_string(static_cast<unsigned long long>(version)));
+}
+
+} /* namespace db */ } /* namespace range */
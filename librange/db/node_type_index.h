@@ -0,0 +1,116 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _RANGE_DB_NODE_TYPE_INDEX_H
+#define _RANGE_DB_NODE_TYPE_INDEX_H
+
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "../graph/node_interface.h"
+#include "../core/log.h"
+
+#include "nodeinfo.pb.h"
+#include "db_interface.h"
+#include "live_intervals.h"
+#include "sharded_index.h"
+
+namespace range { namespace db {
+
+extern ::range::EmitterModuleRegistration NodeTypeIndexLogModule;
+//##############################################################################
+/// Secondary index from node type to the names of the nodes of that type,
+/// with the [first, last) graph versions each was part of the graph as that
+/// type; the same intervals ProtobufNode keeps for itself.
+///
+/// Each type's entries are spread over NODE_META records by crc32 of the
+/// name, as many as keep each under max_shard_entries (see
+/// ShardedIndexRecords), so that adding a host rewrites a small record
+/// rather than one listing every host.
+///
+/// The GRAPH_META "type_index" record holds the first graph version the
+/// index is complete from, 0 for graphs BerkeleyDB::createGraphInstance
+/// made; graphs created before the index existed have to be indexed by
+/// range_upgrade before it is used.
+class NodeTypeIndex {
+    public:
+        typedef graph::NodeIface::node_type node_type;
+        typedef boost::shared_ptr<GraphInstanceInterface> instance_t;
+        typedef ::range::db::intervals_t intervals_t;
+
+        static const uint32_t min_shards = 64;                                  ///< per type
+        static const int max_shard_entries = 512;
+        static const uint32_t format_version = 2;                               ///< TypeIndexShard.format_version this writes
+
+        //######################################################################
+        explicit NodeTypeIndex(instance_t instance)
+            : instance_(instance),
+            records_(instance, "type_index:", min_shards, max_shard_entries, format_version,
+                    NodeTypeIndexLogModule),
+            log(NodeTypeIndexLogModule)
+        {
+        }
+
+        //######################################################################
+        /// name is part of the graph as a node of type from version on
+        void add(node_type type, const std::string &name, uint64_t version);
+
+        //######################################################################
+        /// name is no longer part of the graph as a node of type at version
+        void remove(node_type type, const std::string &name, uint64_t version);
+
+        //######################################################################
+        /// Used to (re)build the index; held until flush()
+        ///
+        /// @param[in] live intervals name has been part of the graph as type;
+        ///             name must not already be in the index
+        void add_intervals(node_type type, const std::string &name, const intervals_t &live);
+
+        //######################################################################
+        /// Empty the index; held until flush()
+        void clear();
+
+        //######################################################################
+        /// Write out changes held by add_intervals() and clear()
+        void flush();
+
+        //######################################################################
+        /// @param[in] type node type wanted
+        /// @param[in] version graph version, at least complete_from()
+        /// @return names of the nodes of type at version, in name order
+        std::vector<std::string> find(node_type type, uint64_t version) const;
+
+        //######################################################################
+        /// @return first graph version the index can answer for, or -1
+        uint64_t complete_from() const;
+        void set_complete_from(uint64_t version);
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        instance_t instance_;
+        mutable ShardedIndexRecords<TypeIndexShard, TypeIndexShard_Entry> records_;    ///< grouped by type
+        range::Emitter log;
+
+        //######################################################################
+        static std::string group(node_type type);
+};
+
+} /* namespace db */ } /* namespace range */
+
+#endif
@@ -0,0 +1,103 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _RANGE_DB_PACKED_VERSION_INDEX_H
+#define _RANGE_DB_PACKED_VERSION_INDEX_H
+
+#include <cstdint>
+#include <string>
+
+namespace range { namespace db {
+
+//##############################################################################
+/// A record holding (key, value) pairs of big-endian uint64s, appended in
+/// ascending key order; so that it can be binary searched in place, without
+/// parsing it into anything first.
+///
+/// @code{.cpp}
+///     PackedVersionIndex idx { instance->get_record(type, key) };
+///     size_t i = idx.lower_bound(version + 1);                // first entry past version
+///     uint64_t found = (i == 0) ? -1 : idx.value(i - 1);
+/// @endcode
+class PackedVersionIndex {
+    public:
+        static const size_t entry_size = 16;
+
+        //######################################################################
+        explicit PackedVersionIndex(const std::string &record = std::string())
+            : buf_(record)
+        {
+            buf_.resize(buf_.size() - (buf_.size() % entry_size));              // drop a torn trailing entry
+        }
+
+        //######################################################################
+        size_t size() const { return buf_.size() / entry_size; }
+        bool empty() const { return buf_.empty(); }
+        uint64_t key(size_t i) const { return read_be64(buf_.data() + i * entry_size); }
+        uint64_t value(size_t i) const { return read_be64(buf_.data() + i * entry_size + 8); }
+        const std::string& str() const { return buf_; }
+
+        //######################################################################
+        void reserve(size_t n) { buf_.reserve(n * entry_size); }
+        void clear() { buf_.clear(); }
+
+        //######################################################################
+        void append(uint64_t key, uint64_t value) {
+            append_be64(key);
+            append_be64(value);
+        }
+
+        //######################################################################
+        /// @return index of the first entry whose key is not less than k, or
+        ///         size() if there is none
+        size_t lower_bound(uint64_t k) const {
+            size_t lo = 0;
+            size_t hi = size();
+            while(lo < hi) {
+                size_t mid = lo + (hi - lo) / 2;
+                if(key(mid) < k) {
+                    lo = mid + 1;
+                }
+                else {
+                    hi = mid;
+                }
+            }
+            return lo;
+        }
+
+    private:
+        //######################################################################
+        void append_be64(uint64_t v) {
+            for (int shift = 56; shift >= 0; shift -= 8) {
+                buf_.push_back(static_cast<char>((v >> shift) & 0xff));
+            }
+        }
+
+        //######################################################################
+        static uint64_t read_be64(const char *p) {
+            uint64_t v = 0;
+            for (int i = 0; i < 8; ++i) {
+                v = (v << 8) | static_cast<unsigned char>(p[i]);
+            }
+            return v;
+        }
+
+        std::string buf_;
+};
+
+} /* namespace db */ } /* namespace range */
+
+#endif
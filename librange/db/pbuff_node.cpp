@@ -15,20 +15,24 @@
  * along with range++.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
 #include <iostream>
 
 #include <boost/make_shared.hpp>
 
 #include "db_exceptions.h"
 #include "pbuff_node.h"
+#include "node_info_cache.h"
+#include "node_type_index.h"
+#include "node_tag_index.h"
 #include "../util/crc32.h"
 
 namespace range { namespace db {
 
-typedef boost::shared_ptr<ProtobufNode> pbuffnode_t;
 typedef GraphInstanceInterface::record_type rectype_t;
 
 ::range::EmitterModuleRegistration ProtobufNodeLogModule { "db.ProtobufNode" };
+const uint32_t ProtobufNode::format_version;
 
 //##############################################################################
 //##############################################################################
@@ -43,7 +47,8 @@ write_record(const std::string& name, NodeInfo& info,
     uint32_t crc = range::util::crc32(info.SerializeAsString());
     info.set_crc32(crc);
 
-    if(!instance->write_record(rectype, name, info.list_version(), info.SerializeAsString())) {
+    if(!instance->write_record(rectype, name, info.list_version(),
+                NodeRecord::encode(info, instance->node_record_encoding()))) {
         return false;
     }
     return true;
@@ -148,6 +153,10 @@ init_default_nodeinfo(NodeInfo& info) //, uint64_t graph_version)
 }
 
 
+//##############################################################################
+//##############################################################################
+static inline bool info_live_at_or_after(const NodeInfo& info, uint64_t version);
+
 //##############################################################################
 //##############################################################################
 static inline void
@@ -195,26 +204,56 @@ ProtobufNode::init_info() const
     BOOST_LOG_FUNCTION();
     if (instance_) {
         if(!info_initialized) { 
-            NodeInfo tmp;
+            auto cache = NodeInfoCache::get();
+            boost::shared_ptr<NodeRecord> tmp;
+            uint64_t generation = 0;
             {
                 auto lock = instance_->read_lock(rectype, name_);
-                std::string buffer { instance_->get_record(rectype, name_) };
+                generation = instance_->cache_generation(rectype, name_);
+                if(generation) {
+                    auto cached = cache->lookup(instance_->graph_name(), name_, generation);
+                    if(cached) {
+                        LOG(debug5, "initialized_from_cache") << name_ << " is initialized from cache";
+                        shared_record_ = cached;
+                        std::string().swap(record_);
+                        record_primed_ = false;
+                        type_ = node_type(shared_record_->header().node_type());
+                        info_initialized = true;
+                        return;
+                    }
+                }
+
+                std::string buffer;
+                if(record_primed_) {
+                    buffer.swap(record_);
+                    record_primed_ = false;
+                }
+                else {
+                    buffer = instance_->get_record(rectype, name_);
+                }
 
-                if (buffer.length() > 0) {
-                    tmp.ParseFromString(buffer);
+                if(generation) {                                                    // readers decode what they use
+                    tmp = boost::make_shared<NodeRecord>(std::move(buffer));
+                }
+                else if (buffer.length() > 0) {                                     // writers need all of it
+                    NodeRecord::decode(buffer, &info);
                 }
             }
 
-            if (tmp.IsInitialized())                                                // newer node in db
+            if (tmp ? tmp->valid() : info.IsInitialized())                          // newer node in db
             {
                 LOG(debug5, "initialized_from_buffer") << name_ << " is initialized from buffer";
-                info = tmp;
-                type_ = node_type(info.node_type());
-                info_initialized = info.IsInitialized();
+                if(tmp) {
+                    shared_record_ = tmp;
+                    cache->insert(instance_->graph_name(), name_, generation, shared_record_);
+                }
+                type_ = node_type(node_header().node_type());
+                info_initialized = true;
             }
             else                                                                    // new node
             {                                            
                 LOG(debug5, "uninitialized") << name_ << " is NOT initialized";
+                info.Clear();                                                   // whatever a partial decode left
                 init_default_nodeinfo(info); //, instance_->version());
                 info_initialized = info.IsInitialized();
             }
@@ -226,6 +265,20 @@ ProtobufNode::init_info() const
 }
 
 
+//##############################################################################
+// Mutators work on our own copy; never on the one shared through the cache
+//##############################################################################
+inline void
+ProtobufNode::detach_info()
+{
+    init_info();
+    if (shared_record_) {
+        shared_record_->decode(&info);
+        shared_record_.reset();
+    }
+}
+
+
 //##############################################################################
 //##############################################################################
 GraphInstanceInterface::lock_t
@@ -233,11 +286,27 @@ ProtobufNode::info_lock(bool writable)
 {
     BOOST_LOG_FUNCTION();
     auto lock = (writable) ? instance_->write_lock(rectype, name_) : instance_->read_lock(rectype, name_);
-    init_info();
+    detach_info();
     return lock;
 }
 
 
+//##############################################################################
+//##############################################################################
+static inline bool
+edge_present_at(const NodeInfo_Adjacency &edge, uint64_t cmp_version)
+{
+    for (int ver_idx = edge.versions_size() - 1; ver_idx >= 0; --ver_idx) {
+        if (edge.versions(ver_idx) == cmp_version) {
+            return true;
+        }
+        if (edge.versions(ver_idx) < cmp_version) {
+            break;
+        }
+    }
+    return false;
+}
+
 //##############################################################################
 //##############################################################################
 inline std::vector<ProtobufNode::node_t>
@@ -246,27 +315,41 @@ ProtobufNode::get_edges(const NodeInfo_Edges& direction) const
     BOOST_LOG_FUNCTION();
     std::vector<node_t> found_edges;
 
-    uint64_t cmp_version = (wanted_version_ == static_cast<uint64_t>(-1)) ? info.list_version() : wanted_version_;
+    uint64_t cmp_version = (wanted_version_ == static_cast<uint64_t>(-1)) ? node_header().list_version() : wanted_version_;
 
     for (int i = 0; i < direction.edges_size(); ++i) {
-        size_t ver_size = direction.edges(i).versions_size();
-        for (int ver_idx = ver_size - 1; ver_idx >= 0; --ver_idx) {
-            if (direction.edges(i).versions(ver_idx) == cmp_version) {
-                pbuffnode_t n = boost::make_shared<ProtobufNode>( 
-                        direction.edges(i).id(), instance_, wanted_version_
-                        );
-                found_edges.push_back(n);
-                break;
-            }
-            if (direction.edges(i).versions(ver_idx) < cmp_version) {
-                break;
-            }
+        if (edge_present_at(direction.edges(i), cmp_version)) {
+            found_edges.push_back(make_node(direction.edges(i).id()));
         }
     }
     return found_edges;
 }
 
 
+//##############################################################################
+// The names point into direction, which is either our copy of the record or
+// the one shared through the cache; holding on to ourselves keeps it alive.
+//##############################################################################
+inline graph::EdgeRange
+ProtobufNode::get_edge_range(const NodeInfo_Edges& direction) const
+{
+    BOOST_LOG_FUNCTION();
+    std::vector<graph::EdgeRange::edge_t> found_edges;
+
+    uint64_t cmp_version = (wanted_version_ == static_cast<uint64_t>(-1)) ? node_header().list_version() : wanted_version_;
+
+    for (int i = 0; i < direction.edges_size(); ++i) {
+        if (edge_present_at(direction.edges(i), cmp_version)) {
+            found_edges.push_back({ direction.edges(i).id(), cmp_version });
+        }
+    }
+
+    auto self = shared_from_this();
+    return graph::EdgeRange(self, std::move(found_edges),
+            [self](size_t, boost::string_ref name) { return self->make_node(name.to_string()); });
+}
+
+
 //##############################################################################
 //##############################################################################
 std::vector<ProtobufNode::node_t>
@@ -275,10 +358,7 @@ ProtobufNode::forward_edges() const
     BOOST_LOG_FUNCTION();
     init_info();
 
-    if (info.has_forward()) {
-        return get_edges(info.forward());
-    }
-    return std::vector<node_t>();
+    return get_edges(node_forward());
 }
 
 
@@ -290,10 +370,31 @@ ProtobufNode::reverse_edges() const
     BOOST_LOG_FUNCTION();
     init_info();
 
-    if (info.has_reverse()) {
-        return get_edges(info.reverse());
-    }
-    return std::vector<node_t>();
+    return get_edges(node_reverse());
+}
+
+
+//##############################################################################
+//##############################################################################
+graph::EdgeRange
+ProtobufNode::forward_edge_range() const
+{
+    BOOST_LOG_FUNCTION();
+    init_info();
+
+    return get_edge_range(node_forward());
+}
+
+
+//##############################################################################
+//##############################################################################
+graph::EdgeRange
+ProtobufNode::reverse_edge_range() const
+{
+    BOOST_LOG_FUNCTION();
+    init_info();
+
+    return get_edge_range(node_reverse());
 }
 
 
@@ -314,7 +415,7 @@ ProtobufNode::type() const
     BOOST_LOG_FUNCTION();
     init_info();
 
-    return node_type(info.node_type());
+    return node_type(node_header().node_type());
 }
 
 
@@ -325,7 +426,7 @@ ProtobufNode::version() const
 {
     BOOST_LOG_FUNCTION();
     init_info();
-    return info.list_version();
+    return node_header().list_version();
 }
 
 //##############################################################################
@@ -345,23 +446,19 @@ ProtobufNode::crc32() const
     BOOST_LOG_FUNCTION();
     init_info();
 
-    return info.crc32();
+    return node_header().crc32();
 }
 
 
 //##############################################################################
 //##############################################################################
-std::unordered_map<std::string, std::vector<std::string>>
-ProtobufNode::tags() const
+static inline std::unordered_map<std::string, std::vector<std::string>>
+tags_at(const NodeInfo_Tags &tags, uint64_t cmp_version)
 {
-    BOOST_LOG_FUNCTION();
-    init_info();
     std::unordered_map<std::string, std::vector<std::string>> tagtable;
 
-    uint64_t cmp_version = (wanted_version_ == static_cast<uint64_t>(-1)) ? info.list_version() : wanted_version_;
-
-    for (int key_idx = 0; key_idx < info.tags().keys_size(); ++key_idx) {
-        const auto& key = info.tags().keys(key_idx);
+    for (int key_idx = 0; key_idx < tags.keys_size(); ++key_idx) {
+        const auto& key = tags.keys(key_idx);
         for (int ver_idx = key.versions_size() - 1; ver_idx >= 0; --ver_idx) {
             uint64_t key_ver = key.versions(ver_idx);
             if (cmp_version == key_ver) {
@@ -379,6 +476,17 @@ ProtobufNode::tags() const
     return tagtable;
 }
 
+//##############################################################################
+//##############################################################################
+std::unordered_map<std::string, std::vector<std::string>>
+ProtobufNode::tags() const
+{
+    BOOST_LOG_FUNCTION();
+    init_info();
+    uint64_t cmp_version = (wanted_version_ == static_cast<uint64_t>(-1)) ? node_header().list_version() : wanted_version_;
+    return tags_at(node_tags(), cmp_version);
+}
+
 
 //##############################################################################
 //##############################################################################
@@ -449,7 +557,7 @@ ProtobufNode::add_edge(const NodeInfo_Edges &direction,
     update_tag_versions(info, cmp_version, new_version);
     info.set_list_version(new_version);
 
-    if(!write_record(name_, info, instance_)) {
+    if(!write_info()) {
         LOG(error, "add_edge_failed") << name_ << " other: " << other->name();
         return false;
     }
@@ -463,6 +571,7 @@ bool
 ProtobufNode::add_forward_edge(node_t other, bool update_other_reverse_edge)
 {
     BOOST_LOG_FUNCTION();
+    detach_info();                                                              // direction references must point at our own copy
     LOG(debug9, "add_forward_edge") << name_ << " " << other->name();
     if(! add_edge(info.forward(), info.mutable_forward(), other)) {
         return false;
@@ -481,6 +590,7 @@ bool
 ProtobufNode::add_reverse_edge(node_t other, bool update_other_forward_edge)
 {
     BOOST_LOG_FUNCTION();
+    detach_info();                                                              // direction references must point at our own copy
     LOG(debug9, "add_reverse_edge") << name_ << " " << other->name();
     if(! add_edge(info.reverse(), info.mutable_reverse(), other)) {
         return false;
@@ -541,7 +651,7 @@ ProtobufNode::remove_edge( const NodeInfo_Edges &direction,
     mutable_edge->mutable_versions()->RemoveLast();                             // We can safely assume that the last element is new_version, because we
                                                                                 // just added it in update_all_edge_versions
 
-    if(!write_record(name_, info, instance_)) {
+    if(!write_info()) {
         LOG(error, "remove_edge_failed") << name_ << " to " << other->name();
         return false;
     }
@@ -555,6 +665,7 @@ bool
 ProtobufNode::remove_forward_edge(node_t other, bool update_other_reverse_edge)
 {
     BOOST_LOG_FUNCTION();
+    detach_info();                                                              // direction references must point at our own copy
     LOG(debug9, "remove_forward_edge") << name_ << " " << other->name();
     if (! remove_edge(info.forward(), info.mutable_forward(), other)) {
         return false;
@@ -574,6 +685,7 @@ bool
 ProtobufNode::remove_reverse_edge(node_t other, bool update_other_forward_edge)
 {
     BOOST_LOG_FUNCTION();
+    detach_info();                                                              // direction references must point at our own copy
     LOG(debug9, "remove_reverse_edge") << name_ << " " << other->name();
     if (! remove_edge(info.reverse(), info.mutable_reverse(), other)) {
         return false;
@@ -603,6 +715,9 @@ ProtobufNode::update_tag(const std::string& key, const std::vector<std::string>&
     uint64_t cmp_list_version = info.list_version();
     uint64_t new_list_version = cmp_list_version + 1;
 
+    auto old_tags = tags_at(info.tags(), cmp_list_version);
+    auto old_values = old_tags.find(key);
+
     for (key_idx = 0; key_idx < info.tags().keys_size(); ++key_idx) {
         if (key == info.tags().keys(key_idx).key()) {
             kv = info.mutable_tags()->mutable_keys(key_idx);
@@ -648,10 +763,17 @@ ProtobufNode::update_tag(const std::string& key, const std::vector<std::string>&
         add_unique_new_version(vptr, new_version);
     }
 
-    if(!write_record(name_, info, instance_)) {
+    if(!write_info()) {
         LOG(error, "update_tag_failed");
         return false;
     }
+
+    uint64_t graph_version = instance_->version();
+    if (info_live_at_or_after(info, graph_version)) {                          // only nodes in the graph are indexed
+        NodeTagIndex(instance_).update(name_, key,
+                (old_values == old_tags.end()) ? std::vector<std::string>() : old_values->second,
+                values, graph_version);
+    }
     return true;
 }
 
@@ -693,16 +815,23 @@ ProtobufNode::delete_tag(const std::string& key)
         return false;
     }
 
+    auto old_tags = tags_at(info.tags(), cmp_version);
+
     info.set_list_version(new_version);
 
     update_tag_versions(info, cmp_version, new_version);
     update_all_edge_versions(info, cmp_version, new_version);
     info.mutable_tags()->mutable_keys(key_idx)->mutable_versions()->RemoveLast();
 
-    if(!write_record(name_, info, instance_)) {
+    if(!write_info()) {
         return false;
     }
 
+    uint64_t graph_version = instance_->version();
+    auto old_values = old_tags.find(key);
+    if (old_values != old_tags.end() && info_live_at_or_after(info, graph_version)) {
+        NodeTagIndex(instance_).update(name_, key, old_values->second, { }, graph_version);
+    }
     return true;
 }
 
@@ -735,7 +864,14 @@ ProtobufNode::set_type(node_type type)
     update_tag_versions(info, cmp_version, new_version);
     update_all_edge_versions(info, cmp_version, new_version);
 
-    write_record(name_, info, instance_);
+    write_info();
+
+    uint64_t graph_version = instance_->version();
+    if (old_type != type && info_live_at_or_after(info, graph_version)) {      // only nodes in the graph are indexed
+        NodeTypeIndex index { instance_ };
+        index.remove(old_type, name_, graph_version);
+        index.add(type, name_, graph_version);
+    }
     return old_type;
 }
 
@@ -748,9 +884,34 @@ ProtobufNode::commit()
 {
     BOOST_LOG_FUNCTION();
     //auto lock = instance_->write_lock(rectype, name_);
+    detach_info();
+    return write_info();
+}
+
+//##############################################################################
+//##############################################################################
+bool
+ProtobufNode::write_info()
+{
     return write_record(name_, info, instance_);
 }
 
+//##############################################################################
+//##############################################################################
+bool
+ProtobufNode::needs_rewrite(const std::string &record) const
+{
+    return NodeRecord::encoding_of(record) != instance_->node_record_encoding();
+}
+
+//##############################################################################
+//##############################################################################
+ProtobufNode::node_t
+ProtobufNode::make_node(const std::string &name) const
+{
+    return boost::make_shared<ProtobufNode>(name, instance_, wanted_version_);
+}
+
 //##############################################################################
 //##############################################################################
 bool
@@ -758,15 +919,97 @@ ProtobufNode::is_valid() const
 {
     BOOST_LOG_FUNCTION();
 
-    auto copy = info;
+    NodeInfo copy;
+    if (shared_record_) {
+        shared_record_->decode(&copy);
+    }
+    else {
+        copy.CopyFrom(info);
+    }
     copy.set_crc32(0);
     uint32_t crc = range::util::crc32(copy.SerializeAsString());
 
-    return info.crc32() == crc;
+    return node_header().crc32() == crc;
+}
+
+//##############################################################################
+// Before format 1, graph_versions listed every graph version the node was
+// part of; which meant every node was rewritten on every graph commit. Now
+// they are [first, last) intervals. Nodes still at the end of the list at
+// live_through are taken to still be part of the graph.
+//##############################################################################
+static inline bool
+upgrade_graph_versions(NodeInfo& info, uint64_t live_through)
+{
+    if (info.format_version() >= ProtobufNode::format_version) {
+        return false;
+    }
+
+    info.clear_live();
+    NodeInfo_Interval *cur = nullptr;
+    uint64_t prev = 0;
+    for (int i = 0; i < info.graph_versions_size(); ++i) {
+        uint64_t v = info.graph_versions(i);
+        if (cur && (v == prev || v == prev + 1)) {
+            prev = v;
+            continue;
+        }
+        if (cur) {
+            cur->set_last(prev + 1);
+        }
+        cur = info.add_live();
+        cur->set_first(v);
+        prev = v;
+    }
+    if (cur && prev < live_through) {
+        cur->set_last(prev + 1);
+    }
+    info.clear_graph_versions();
+    info.set_format_version(ProtobufNode::format_version);
+    return true;
 }
 
 //##############################################################################
 //##############################################################################
+static inline bool
+info_live_at(const NodeInfo& info, uint64_t version)
+{
+    if (info.format_version() < ProtobufNode::format_version) {
+        for (int i = info.graph_versions_size() - 1; i >= 0; --i) {
+            if (info.graph_versions(i) == version) {
+                return true;
+            }
+            if (info.graph_versions(i) < version) {
+                break;
+            }
+        }
+        return false;
+    }
+    for (int i = info.live_size() - 1; i >= 0; --i) {
+        const NodeInfo_Interval &interval = info.live(i);
+        if (version >= interval.first()) {
+            return !interval.has_last() || version < interval.last();
+        }
+    }
+    return false;
+}
+
+//##############################################################################
+//##############################################################################
+static inline bool
+info_live_at_or_after(const NodeInfo& info, uint64_t version)
+{
+    if (info.format_version() < ProtobufNode::format_version) {
+        int n = info.graph_versions_size();
+        return n > 0 && info.graph_versions(n - 1) >= version;
+    }
+    int n = info.live_size();
+    return n > 0 && (!info.live(n - 1).has_last() || info.live(n - 1).last() > version);
+}
+
+//##############################################################################
+// Only writes if the node wasn't already part of the graph at version
+//##############################################################################
 void
 ProtobufNode::add_graph_version(uint64_t version)
 {
@@ -774,31 +1017,159 @@ ProtobufNode::add_graph_version(uint64_t version)
 
     auto txn = instance_->start_txn();
     auto lock = info_lock(true);
-    for(int i = info.graph_versions_size() - 1; i >= 0; --i) {
-        if (version == info.graph_versions(i)) {
-            return;
+    bool changed = upgrade_graph_versions(info, version - 1);
+
+    bool added = false;
+    if (!info_live_at(info, version)) {
+        int n = info.live_size();
+        if (n > 0 && info.live(n - 1).has_last() && info.live(n - 1).last() == version) {
+            info.mutable_live(n - 1)->clear_last();                            // removed and re-added in consecutive versions
+            added = true;
         }
-        if(version < info.graph_versions(i)) {
-            return;
+        else if (n == 0 || (info.live(n - 1).has_last() && info.live(n - 1).last() < version)) {
+            info.add_live()->set_first(version);
+            added = true;
         }
-    } 
+    }
 
-    info.add_graph_versions(version);
-    write_record(name_, info, instance_, rectype_t::NODE_META);
+    if (changed || added) {
+        write_info();
+        if (added) {
+            NodeTypeIndex(instance_).add(node_type(info.node_type()), name_, version);
+            NodeTagIndex(instance_).add_node(name_, tags_at(info.tags(), info.list_version()), version);
+        }
+        txn->flush();
+    }
+}
+
+//##############################################################################
+//##############################################################################
+void
+ProtobufNode::remove_graph_version(uint64_t version)
+{
+    RANGE_LOG_TIMED_FUNCTION() << name_ << ": " << version;
+
+    auto txn = instance_->start_txn();
+    auto lock = info_lock(true);
+    bool changed = upgrade_graph_versions(info, version - 1);
+
+    bool removed = false;
+    int n = info.live_size();
+    if (n > 0 && !info.live(n - 1).has_last()) {
+        if (info.live(n - 1).first() >= version) {                              // added and removed in the same version
+            info.mutable_live()->RemoveLast();
+        }
+        else {
+            info.mutable_live(n - 1)->set_last(version);
+        }
+        removed = true;
+    }
+
+    if (changed || removed) {
+        write_info();
+        if (removed) {
+            NodeTypeIndex(instance_).remove(node_type(info.node_type()), name_, version);
+            NodeTagIndex(instance_).remove_node(name_, tags_at(info.tags(), info.list_version()), version);
+        }
+        txn->flush();
+    }
+}
+
+//##############################################################################
+//##############################################################################
+bool
+ProtobufNode::upgrade_format(uint64_t graph_version)
+{
+    RANGE_LOG_TIMED_FUNCTION() << name_;
+
+    auto txn = instance_->start_txn();
+    auto lock = info_lock(true);
+    std::string record = instance_->get_record(rectype, name_);
+    bool rewrite = !record.empty() && needs_rewrite(record);
+    if (!upgrade_graph_versions(info, graph_version) && !rewrite) {
+        return false;
+    }
+    write_info();
     txn->flush();
-    return;
+    return true;
+}
+
+//##############################################################################
+// Nodes still in the old format have no intervals to index; upgrade_format()
+// them first.
+//##############################################################################
+void
+ProtobufNode::add_to_type_index(NodeTypeIndex &index) const
+{
+    RANGE_LOG_TIMED_FUNCTION() << name_;
+    init_info();
+    const NodeInfo &cur = node_header();
+    index.add_intervals(node_type(cur.node_type()), name_, cur.live());
+}
+
+//##############################################################################
+// Tag history is per list_version, so only the current tags of nodes part of
+// the graph at graph_version can be indexed.
+//##############################################################################
+void
+ProtobufNode::add_to_tag_index(NodeTagIndex &index, uint64_t graph_version) const
+{
+    RANGE_LOG_TIMED_FUNCTION() << name_;
+    init_info();
+    const NodeInfo &cur = node_header();
+    if (info_live_at(cur, graph_version)) {
+        index.add_tags(name_, tags_at(node_tags(), cur.list_version()), graph_version);
+    }
+}
+
+//##############################################################################
+//##############################################################################
+bool
+ProtobufNode::live_at(uint64_t version) const
+{
+    BOOST_LOG_FUNCTION();
+    init_info();
+    return info_live_at(node_header(), version);
 }
 
 //##############################################################################
 //##############################################################################
+bool
+ProtobufNode::live_at_or_after(uint64_t version) const
+{
+    BOOST_LOG_FUNCTION();
+    init_info();
+    return info_live_at_or_after(node_header(), version);
+}
+
+//##############################################################################
+// Prefer live_at(); listing every version of a long-lived node is expensive
+//##############################################################################
 std::vector<uint64_t>
 ProtobufNode::graph_versions() const
 {
     BOOST_LOG_FUNCTION();
     init_info();
     std::vector<uint64_t> vers;
-    for (int i = 0; i < info.graph_versions_size(); ++i) {
-        vers.push_back(info.graph_versions(i));
+    const NodeInfo &cur = node_header();
+    if (cur.format_version() < format_version) {
+        for (int i = 0; i < cur.graph_versions_size(); ++i) {
+            vers.push_back(cur.graph_versions(i));
+        }
+        return vers;
+    }
+
+    uint64_t head = 0;
+    for (int i = 0; i < cur.live_size(); ++i) {
+        const NodeInfo_Interval &interval = cur.live(i);
+        uint64_t last = interval.last();
+        if (!interval.has_last()) {
+            head = head ? head : instance_->version();
+            last = std::max(head, interval.first()) + 1;
+        }
+        for (uint64_t v = interval.first(); v < last; ++v) {
+            vers.push_back(v);
+        }
     }
     return vers;
 }
@@ -813,6 +1184,9 @@ ProtobufNode::set_instance(instance_t instance)
     instance_t old_instance = instance_;
     instance_ = instance;
     info_initialized = false;
+    shared_record_.reset();
+    std::string().swap(record_);
+    record_primed_ = false;
     return old_instance;
 }
 
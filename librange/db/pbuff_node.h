@@ -25,10 +25,13 @@
 
 #include "nodeinfo.pb.h"
 #include "db_interface.h"
+#include "node_record.h"
 
 
 namespace range { namespace db { 
 
+class NodeTypeIndex;
+class NodeTagIndex;
 extern ::range::EmitterModuleRegistration ProtobufNodeLogModule;
 //##############################################################################
 //##############################################################################
@@ -40,23 +43,40 @@ class ProtobufNode : public graph::NodeIface, public boost::enable_shared_from_t
     
         //######################################################################
         inline ProtobufNode()
-            : name_(), instance_(), wanted_version_(-1),
-            type_(node_type::UNKNOWN), info_initialized(false), info(),
-            log(ProtobufNodeLogModule)
+            : name_(), instance_(), wanted_version_(-1), info(), log(ProtobufNodeLogModule),
+            type_(node_type::UNKNOWN), info_initialized(false),
+            shared_record_(), record_(), record_primed_(false)
         {
         }
 
         inline ProtobufNode(const std::string& name, instance_t instance, 
                             uint64_t version = -1)
             : name_(name), instance_(instance), wanted_version_(version),
+                info(), log(ProtobufNodeLogModule),
                 type_(node_type::UNKNOWN), info_initialized(false),
-                log(ProtobufNodeLogModule)
+                shared_record_(), record_(), record_primed_(false)
+        {
+        }
+
+        //######################################################################
+        /// For callers that have already read the node's record (e.g. a
+        /// cursor), so that we don't read it from the instance a second time.
+        ///
+        /// @param[in] record serialized NodeInfo as stored under name
+        inline ProtobufNode(const std::string& name, instance_t instance,
+                            std::string&& record, uint64_t version = -1)
+            : name_(name), instance_(instance), wanted_version_(version),
+                info(), log(ProtobufNodeLogModule),
+                type_(node_type::UNKNOWN), info_initialized(false),
+                shared_record_(), record_(std::move(record)), record_primed_(true)
         {
         }
 
         //######################################################################
         virtual std::vector<node_t> forward_edges() const override;
         virtual std::vector<node_t> reverse_edges() const override;
+        virtual graph::EdgeRange forward_edge_range() const override;
+        virtual graph::EdgeRange reverse_edge_range() const override;
 
         //######################################################################
         virtual std::string name() const override;
@@ -93,7 +113,34 @@ class ProtobufNode : public graph::NodeIface, public boost::enable_shared_from_t
         virtual bool commit() override;
 
         virtual void add_graph_version(uint64_t version) override;
+        virtual void remove_graph_version(uint64_t version) override;
         virtual std::vector<uint64_t> graph_versions() const override;
+        virtual bool live_at(uint64_t version) const override;
+        virtual bool live_at_or_after(uint64_t version) const override;
+
+        //######################################################################
+        /// Rewrite a record from an older format_version in the current one,
+        /// or from another encoding in the graph's node_record_encoding()
+        ///
+        /// @param graph_version current version of the graph
+        /// @return true if the record was rewritten
+        virtual bool upgrade_format(uint64_t graph_version);
+
+        static const uint32_t format_version = 1;                               ///< NodeInfo.format_version this writes
+
+        //######################################################################
+        /// Add this node's graph versions to index; for (re)building it
+        ///
+        /// @param[in,out] index type index being built, written on its flush()
+        void add_to_type_index(NodeTypeIndex &index) const;
+
+        //######################################################################
+        /// Add this node's current tags to index, if it is part of the graph
+        /// at graph_version; for (re)building it
+        ///
+        /// @param[in,out] index tag index being built, written on its flush()
+        /// @param[in] graph_version current version of the graph
+        void add_to_tag_index(NodeTagIndex &index, uint64_t graph_version) const;
 
         //######################################################################
         instance_t get_instance() const;
@@ -113,22 +160,52 @@ class ProtobufNode : public graph::NodeIface, public boost::enable_shared_from_t
 
     //##########################################################################
     //##########################################################################
-    private:
+    protected:
         std::string name_;
         instance_t instance_;
 
         uint64_t wanted_version_;
         static const auto rectype = GraphInstanceInterface::record_type::NODE;
 
-        mutable node_type type_;
-        mutable bool info_initialized;
         mutable NodeInfo info;
         range::Emitter log;
 
+        //######################################################################
+        /// Only NodeInfo fields outside the sections below may be read from
+        /// node_header()
+        inline const NodeInfo& node_header() const { return shared_record_ ? shared_record_->header() : info; }
+        virtual const NodeInfo_Tags& node_tags() const { return shared_record_ ? shared_record_->tags() : info.tags(); }
+        virtual const NodeInfo_Edges& node_forward() const { return shared_record_ ? shared_record_->forward() : info.forward(); }
+        virtual const NodeInfo_Edges& node_reverse() const { return shared_record_ ? shared_record_->reverse() : info.reverse(); }
+
+        //######################################################################
+        /// Write info out as the node's record; called with the node locked
+        virtual bool write_info();
+
+        //######################################################################
+        /// @return true if upgrade_format() should rewrite record even though
+        ///         it is already in the current format_version
+        virtual bool needs_rewrite(const std::string &record) const;
+
+        //######################################################################
+        /// @return a node of our own kind for the other end of an edge
+        virtual node_t make_node(const std::string &name) const;
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        mutable node_type type_;
+        mutable bool info_initialized;
+        mutable boost::shared_ptr<const NodeRecord> shared_record_;             ///< record shared via NodeInfoCache, until we mutate
+        mutable std::string record_;                                            ///< record handed to us by the reader, parsed on first use
+        mutable bool record_primed_;
+
         //######################################################################
         inline void init_info() const;
+        inline void detach_info();
         inline GraphInstanceInterface::lock_t info_lock(bool writable = false);
         inline std::vector<node_t> get_edges(const NodeInfo_Edges& edges) const;
+        inline graph::EdgeRange get_edge_range(const NodeInfo_Edges& edges) const;
         inline bool add_edge(const NodeInfo_Edges &direction, NodeInfo_Edges *mutable_direction, node_t other);
         inline bool remove_edge(const NodeInfo_Edges &direction, NodeInfo_Edges *mutable_direction, node_t other);
 };
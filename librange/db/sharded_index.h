@@ -0,0 +1,271 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _RANGE_DB_SHARDED_INDEX_H
+#define _RANGE_DB_SHARDED_INDEX_H
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <map>
+#include <string>
+
+#include <boost/shared_ptr.hpp>
+
+#include "../core/log.h"
+#include "../util/crc32.h"
+
+#include "db_interface.h"
+
+namespace range { namespace db {
+
+//##############################################################################
+/// The NODE_META records behind a secondary index whose entries are grouped
+/// (by node type, by tag) and looked up by node name.
+///
+/// Each group's entries are spread by crc32 of the name over as many records
+/// as it needs: it starts with min_shards, and doubles them whenever one
+/// outgrows max_entries, so a write rewrites a small record however large
+/// the group gets. "<prefix><group>" holds the group's record count, absent
+/// while it is min_shards; "<prefix><group>:<n>" its records. Entries within
+/// a record are kept in name order.
+///
+/// Shard is a message with `repeated Entry entries`, each Entry having a
+/// name, and a format_version; records older than format_version are taken
+/// to be unsorted.
+//##############################################################################
+template <typename Shard, typename Entry>
+class ShardedIndexRecords {
+    public:
+        typedef boost::shared_ptr<GraphInstanceInterface> instance_t;
+
+        //######################################################################
+        ShardedIndexRecords(instance_t instance, const std::string &prefix,
+                uint32_t min_shards, int max_entries, uint32_t format_version,
+                const EmitterModuleRegistration &module)
+            : instance_(instance), prefix_(prefix), min_shards_(min_shards),
+            max_entries_(max_entries), format_version_(format_version),
+            counts_(), shards_(), log(module)
+        {
+        }
+
+        //######################################################################
+        /// @return name's entry in group, or nullptr
+        const Entry* find(const std::string &group, const std::string &name) const {
+            const Shard &records = load(group, name).records;
+            int i = lower_bound(records, name);
+            return (i < records.entries_size() && records.entries(i).name() == name)
+                ? &records.entries(i) : nullptr;
+        }
+
+        //######################################################################
+        /// @return name's entry in group, added if it isn't there; valid
+        ///         until the next call that adds
+        Entry* insert(const std::string &group, const std::string &name) {
+            Shard &records = load(group, name).records;
+            int i = lower_bound(records, name);
+            if (i < records.entries_size() && records.entries(i).name() == name) {
+                return records.mutable_entries(i);
+            }
+            records.add_entries()->set_name(name);
+            for (int j = records.entries_size() - 1; j > i; --j) {
+                records.mutable_entries()->SwapElements(j, j - 1);
+            }
+            if (records.entries_size() > max_entries_) {
+                split(group);
+                return insert(group, name);
+            }
+            return records.mutable_entries(i);
+        }
+
+        //######################################################################
+        /// Drop name's entry from group
+        void erase(const std::string &group, const std::string &name) {
+            shard_t &shard = load(group, name);
+            int i = lower_bound(shard.records, name);
+            if (i == shard.records.entries_size() || shard.records.entries(i).name() != name) {
+                return;
+            }
+            for (int j = i + 1; j < shard.records.entries_size(); ++j) {
+                shard.records.mutable_entries()->SwapElements(j - 1, j);
+            }
+            shard.records.mutable_entries()->RemoveLast();
+            shard.dirty = true;
+        }
+
+        //######################################################################
+        /// The record holding name's entry in group has changed
+        void changed(const std::string &group, const std::string &name) {
+            load(group, name).dirty = true;
+        }
+
+        //######################################################################
+        /// Call f for every entry of group, in no particular order
+        template <typename F>
+        void for_each(const std::string &group, F f) const {
+            uint32_t n = n_shards(group);
+            for (uint32_t s = 0; s < n; ++s) {
+                for (auto &entry : load_shard(shard_key(group, s)).records.entries()) {
+                    f(entry);
+                }
+            }
+        }
+
+        //######################################################################
+        /// Empty group; held until flush()
+        void clear(const std::string &group) {
+            uint32_t n = n_shards(group);
+            for (uint32_t s = 0; s < n; ++s) {
+                shard_t &shard = shards_[shard_key(group, s)];
+                shard.records.Clear();
+                shard.dirty = true;
+            }
+            set_n_shards(group, min_shards_);
+        }
+
+        //######################################################################
+        /// Write out everything changed
+        void flush() {
+            auto lock = instance_->write_lock(GraphInstanceInterface::record_type::NODE_META, "");
+            for (auto &count : counts_) {
+                if (count.second.dirty) {
+                    instance_->write_record(GraphInstanceInterface::record_type::NODE_META,
+                            prefix_ + count.first, 0,
+                            std::to_string(static_cast<unsigned long long>(count.second.n)));
+                    count.second.dirty = false;
+                }
+            }
+            for (auto &shard : shards_) {
+                if (shard.second.dirty) {
+                    shard.second.records.set_format_version(format_version_);
+                    instance_->write_record(GraphInstanceInterface::record_type::NODE_META,
+                            shard.first, 0, shard.second.records.SerializeAsString());
+                    shard.second.dirty = false;
+                }
+            }
+        }
+
+        //######################################################################
+        /// @return number of records group is spread over
+        uint32_t n_shards(const std::string &group) const {
+            auto it = counts_.find(group);
+            if (it != counts_.end()) {
+                return it->second.n;
+            }
+            count_t &count = counts_[group];
+            count.dirty = false;
+            std::string buf = instance_->get_record(GraphInstanceInterface::record_type::NODE_META,
+                    prefix_ + group);
+            count.n = buf.empty() ? min_shards_ : std::strtoul(buf.c_str(), nullptr, 10);
+            return count.n;
+        }
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        struct shard_t {
+            Shard records;
+            bool dirty;
+        };
+
+        struct count_t {
+            uint32_t n;
+            bool dirty;
+        };
+
+        instance_t instance_;
+        std::string prefix_;
+        uint32_t min_shards_;
+        int max_entries_;
+        uint32_t format_version_;
+        mutable std::map<std::string, count_t> counts_;                         ///< keyed by group
+        mutable std::map<std::string, shard_t> shards_;                         ///< keyed by record name
+        range::Emitter log;
+
+        //######################################################################
+        std::string shard_key(const std::string &group, uint32_t shard) const {
+            return prefix_ + group + ":" + std::to_string(static_cast<unsigned long long>(shard));
+        }
+
+        //######################################################################
+        static int lower_bound(const Shard &records, const std::string &name) {
+            auto it = std::lower_bound(records.entries().begin(), records.entries().end(), name,
+                    [](const Entry &e, const std::string &n) { return e.name() < n; });
+            return it - records.entries().begin();
+        }
+
+        //######################################################################
+        void set_n_shards(const std::string &group, uint32_t n) {
+            n_shards(group);
+            count_t &count = counts_[group];
+            if (count.n != n) {
+                count.n = n;
+                count.dirty = true;
+            }
+        }
+
+        //######################################################################
+        shard_t& load(const std::string &group, const std::string &name) const {
+            return load_shard(shard_key(group, util::crc32(name) % n_shards(group)));
+        }
+
+        //######################################################################
+        shard_t& load_shard(const std::string &key) const {
+            auto it = shards_.find(key);
+            if (it != shards_.end()) {
+                return it->second;
+            }
+            shard_t &shard = shards_[key];
+            shard.dirty = false;
+            std::string buf = instance_->get_record(GraphInstanceInterface::record_type::NODE_META, key);
+            if (!buf.empty() && !shard.records.ParseFromString(buf)) {
+                LOG(error, "corrupt_index_shard") << key;
+                shard.records.Clear();
+            }
+            if (shard.records.format_version() < format_version_) {             // written before entries were kept sorted
+                auto entries = shard.records.mutable_entries();
+                std::sort(entries->pointer_begin(), entries->pointer_end(),
+                        [](const Entry *a, const Entry *b) { return a->name() < b->name(); });
+            }
+            return shard;
+        }
+
+        //######################################################################
+        /// Double group's records; each one's entries go to it or its new twin
+        void split(const std::string &group) {
+            uint32_t n = n_shards(group);
+            std::map<uint32_t, Shard> split;
+            for (uint32_t s = 0; s < n; ++s) {
+                Shard &records = load_shard(shard_key(group, s)).records;
+                for (int i = 0; i < records.entries_size(); ++i) {              // in name order, so they stay that way
+                    auto &entry = records.entries(i);
+                    split[util::crc32(entry.name()) % (n * 2)].add_entries()->CopyFrom(entry);
+                }
+            }
+            for (uint32_t s = 0; s < n * 2; ++s) {
+                shard_t &shard = shards_[shard_key(group, s)];
+                shard.records.Clear();
+                shard.records.mutable_entries()->Swap(split[s].mutable_entries());
+                shard.dirty = true;
+            }
+            set_n_shards(group, n * 2);
+            LOG(info, "split_index_group") << prefix_ << group << ": " << n * 2;
+        }
+};
+
+} /* namespace db */ } /* namespace range */
+
+#endif
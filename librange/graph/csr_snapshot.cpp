@@ -0,0 +1,218 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+
+#include <boost/make_shared.hpp>
+
+#include "../core/log.h"
+#include "../db/db_interface.h"
+#include "csr_snapshot.h"
+
+namespace range { namespace graph {
+
+const CsrSnapshot::index_t CsrSnapshot::npos;
+const CsrSnapshot::tags_t CsrSnapshot::no_tags_;
+
+//##############################################################################
+/// Where a graph's published snapshot is kept
+//##############################################################################
+struct snapshot_slot_t {
+    boost::shared_ptr<const CsrSnapshot> snapshot;
+};
+
+static boost::shared_ptr<snapshot_slot_t>
+slot(db::BackendInterface &backend, const std::string &graph)
+{
+    return backend.graph_state<snapshot_slot_t>(graph, []() {
+                return boost::make_shared<snapshot_slot_t>();
+            });
+}
+
+//##############################################################################
+//##############################################################################
+boost::shared_ptr<const CsrSnapshot>
+CsrSnapshot::current(db::BackendInterface &backend, const std::string &graph)
+{
+    return boost::atomic_load(&slot(backend, graph)->snapshot);
+}
+
+//##############################################################################
+//##############################################################################
+void
+CsrSnapshot::publish(db::BackendInterface &backend, const std::string &graph,
+        boost::shared_ptr<const CsrSnapshot> snapshot)
+{
+    boost::atomic_store(&slot(backend, graph)->snapshot, snapshot);
+}
+
+//##############################################################################
+//##############################################################################
+bool
+CsrSnapshot::read_node(const GraphInterface &graph, const std::string &name,
+        node_type type, read_t &r) const
+{
+    r.index = interner_->intern(name);
+    auto n = graph.get_node(name);
+    if (!n) {
+        r.type = node_type::UNKNOWN;
+        return false;
+    }
+    r.type = (type == node_type::UNKNOWN) ? n->type() : type;
+    for (auto &e : n->forward_edge_range()) {
+        r.forward.push_back(interner_->intern(e.name));
+    }
+    for (auto &e : n->reverse_edge_range()) {
+        r.reverse.push_back(interner_->intern(e.name));
+    }
+    auto tags = n->tags();
+    if (!tags.empty()) {
+        auto sorted = boost::make_shared<tags_t>(tags.begin(), tags.end());
+        std::sort(sorted->begin(), sorted->end());
+        r.tags = sorted;
+    }
+    return true;
+}
+
+//##############################################################################
+// An empty snapshot with every row replaced
+//##############################################################################
+boost::shared_ptr<const CsrSnapshot>
+CsrSnapshot::build(const GraphInterface &graph, boost::shared_ptr<NameInterner> interner)
+{
+    BOOST_LOG_FUNCTION();
+    uint64_t version = graph.version();
+    CsrSnapshot empty { interner };
+    std::vector<read_t> rows;
+    for (auto &by_type : graph.nodes_by_type(version)) {
+        for (auto &name : by_type.second) {
+            read_t r;
+            if (empty.read_node(graph, name, by_type.first, r)) {
+                rows.push_back(std::move(r));
+            }
+        }
+    }
+    std::sort(rows.begin(), rows.end(),
+            [](const read_t &a, const read_t &b) { return a.index < b.index; });
+    return empty.replace_rows(version, std::move(rows));
+}
+
+//##############################################################################
+//##############################################################################
+boost::shared_ptr<const CsrSnapshot>
+CsrSnapshot::patch(const GraphInterface &graph, const std::set<std::string> &changed) const
+{
+    BOOST_LOG_FUNCTION();
+    std::vector<read_t> rows(changed.size());
+    auto r = rows.begin();
+    for (auto &name : changed) {                                                // a row that's gone stays, empty
+        read_node(graph, name, node_type::UNKNOWN, *r++);
+    }
+    std::sort(rows.begin(), rows.end(),
+            [](const read_t &a, const read_t &b) { return a.index < b.index; });
+    return replace_rows(graph.version(), std::move(rows));
+}
+
+//##############################################################################
+// One pass over the ids in order, copying runs of this snapshot's edges
+// between the replaced rows; nothing is looked up by name.
+//##############################################################################
+boost::shared_ptr<const CsrSnapshot>
+CsrSnapshot::replace_rows(uint64_t version, std::vector<read_t> &&rows) const
+{
+    boost::shared_ptr<CsrSnapshot> snap { new CsrSnapshot(interner_) };
+    snap->version_ = version;
+
+    size_t n_old = size();
+    size_t n_ids = std::max(n_old, interner_->size());                          // read_node() interned every id in rows
+    snap->types_ = types_;
+    snap->types_.resize(n_ids, node_type::UNKNOWN);
+    snap->tags_ = tags_;
+    snap->tags_.resize(n_ids);
+    snap->forward_offsets_.reserve(n_ids + 1);
+    snap->reverse_offsets_.reserve(n_ids + 1);
+    snap->forward_targets_.reserve(forward_targets_.size());
+    snap->reverse_targets_.reserve(reverse_targets_.size());
+
+    auto copy_rows = [&](index_t first, index_t last) {                         // this snapshot's rows [first, last)
+        last = std::min<index_t>(last, n_old);
+        if (first >= last) {
+            return;
+        }
+        snap->forward_targets_.insert(snap->forward_targets_.end(),
+                forward_targets_.begin() + forward_offsets_[first],
+                forward_targets_.begin() + forward_offsets_[last]);
+        snap->reverse_targets_.insert(snap->reverse_targets_.end(),
+                reverse_targets_.begin() + reverse_offsets_[first],
+                reverse_targets_.begin() + reverse_offsets_[last]);
+        index_t forward_shift = snap->forward_targets_.size() - forward_offsets_[last];
+        index_t reverse_shift = snap->reverse_targets_.size() - reverse_offsets_[last];
+        for (index_t i = first + 1; i <= last; ++i) {
+            snap->forward_offsets_.push_back(forward_offsets_[i] + forward_shift);
+            snap->reverse_offsets_.push_back(reverse_offsets_[i] + reverse_shift);
+        }
+    };
+
+    index_t next = 0;                                                           // first row not laid out yet
+    for (auto &r : rows) {
+        if (r.index < next) {                                                   // named twice
+            continue;
+        }
+        copy_rows(next, r.index);
+        for (index_t i = std::max<index_t>(next, n_old); i < r.index; ++i) {    // ids this snapshot hadn't seen
+            snap->forward_offsets_.push_back(snap->forward_targets_.size());
+            snap->reverse_offsets_.push_back(snap->reverse_targets_.size());
+        }
+        snap->types_[r.index] = r.type;
+        snap->tags_[r.index] = std::move(r.tags);
+        snap->forward_targets_.insert(snap->forward_targets_.end(), r.forward.begin(), r.forward.end());
+        snap->reverse_targets_.insert(snap->reverse_targets_.end(), r.reverse.begin(), r.reverse.end());
+        snap->forward_offsets_.push_back(snap->forward_targets_.size());
+        snap->reverse_offsets_.push_back(snap->reverse_targets_.size());
+        next = r.index + 1;
+    }
+    copy_rows(next, n_ids);
+    for (index_t i = std::max<index_t>(next, n_old); i < n_ids; ++i) {
+        snap->forward_offsets_.push_back(snap->forward_targets_.size());
+        snap->reverse_offsets_.push_back(snap->reverse_targets_.size());
+    }
+    return snap;
+}
+
+//##############################################################################
+//##############################################################################
+CsrSnapshot::index_t
+CsrSnapshot::find(const std::string &name) const
+{
+    index_t id = interner_->find(name);
+    return (id < size()) ? id : npos;
+}
+
+//##############################################################################
+//##############################################################################
+const std::vector<std::string>*
+CsrSnapshot::tag(index_t index, const std::string &key) const
+{
+    const tags_t &t = tags(index);
+    auto it = std::lower_bound(t.begin(), t.end(), key,
+            [](const tags_t::value_type &kv, const std::string &k) { return kv.first < k; });
+    if (it == t.end() || it->first != key) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+} /* namespace graph */ } /* namespace range */
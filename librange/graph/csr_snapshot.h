@@ -0,0 +1,197 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _LIBRANGE_GRAPH__CSR_SNAPSHOT_H
+#define _LIBRANGE_GRAPH__CSR_SNAPSHOT_H
+
+#include <cstdint>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "graph_interface.h"
+#include "name_interner.h"
+
+namespace range { namespace db { class BackendInterface; } }
+
+namespace range { namespace graph {
+
+//##############################################################################
+/// Read-only copy of a whole graph at one version, held in memory in
+/// compressed sparse row form: nodes numbered by their NameInterner ids,
+/// every node's forward and reverse edges as one array of ids each, and
+/// the tags of every node.
+///
+/// A snapshot never changes once built; a newer graph version gets a new
+/// snapshot, published with publish() and picked up by readers with
+/// current(); readers never wait for one to be built. Since ids don't
+/// change between versions, patch() copies the rows of nodes that weren't
+/// written as they are, and the names and tags they share.
+class CsrSnapshot {
+    public:
+        typedef uint32_t index_t;
+        typedef NodeIface::node_type node_type;
+        typedef std::vector<std::pair<std::string, std::vector<std::string>>> tags_t;
+
+        static const index_t npos = static_cast<index_t>(-1);
+
+        //######################################################################
+        /// One node's edges in one direction, in edge order
+        class adjacency_t {
+            public:
+                typedef index_t value_type;
+                typedef const index_t* const_iterator;
+
+                adjacency_t(const index_t *first, const index_t *last)
+                    : first_(first), last_(last) { }
+                const index_t* begin() const { return first_; }
+                const index_t* end() const { return last_; }
+                size_t size() const { return last_ - first_; }
+                bool empty() const { return first_ == last_; }
+            private:
+                const index_t *first_;
+                const index_t *last_;
+        };
+
+        //######################################################################
+        /// Reads every node of graph at its wanted version (head if unset);
+        /// run it inside a read snapshot so the copy is consistent.
+        ///
+        /// @param[in] interner graph's, which numbers the nodes
+        /// @return snapshot of graph, labelled with graph.version()
+        static boost::shared_ptr<const CsrSnapshot> build(const GraphInterface &graph,
+                boost::shared_ptr<NameInterner> interner);
+
+        //######################################################################
+        /// A copy of this snapshot with only the changed nodes re-read from
+        /// graph (or dropped, if they are gone); every other row is copied
+        /// from this one. changed must name every node written since
+        /// version(), e.g. as db::BackendInterface::subscribe_deltas() reports.
+        ///
+        /// @return snapshot of graph, labelled with graph.version()
+        boost::shared_ptr<const CsrSnapshot> patch(const GraphInterface &graph,
+                const std::set<std::string> &changed) const;
+
+        //######################################################################
+        /// @param[in] backend the graph's backend, which keeps the snapshot
+        /// @param[in] graph name of the graph instance, e.g. "primary"
+        /// @return last snapshot published for graph, or nullptr
+        static boost::shared_ptr<const CsrSnapshot> current(db::BackendInterface &backend,
+                const std::string &graph);
+
+        //######################################################################
+        /// Replace graph's snapshot; readers holding the old one keep it
+        /// until they let go
+        static void publish(db::BackendInterface &backend, const std::string &graph,
+                boost::shared_ptr<const CsrSnapshot> snapshot);
+
+        //######################################################################
+        /// @return graph version the snapshot was built at
+        uint64_t version() const { return version_; }
+
+        //######################################################################
+        /// @return number of indexes; every index is below this
+        size_t size() const { return types_.size(); }
+
+        //######################################################################
+        /// @return name's index, or npos if it has none. Names that were
+        ///         interned for other reasons have one too, so check present().
+        index_t find(const std::string &name) const;
+
+        //######################################################################
+        /// @return true if index is a node of the graph, not just the target
+        ///         of a dangling edge
+        bool present(index_t index) const { return types_[index] != node_type::UNKNOWN; }
+
+        //######################################################################
+        const std::string& name(index_t index) const { return interner_->name(index); }
+        node_type type(index_t index) const { return types_[index]; }
+
+        //######################################################################
+        adjacency_t forward(index_t index) const {
+            return adjacency(forward_offsets_, forward_targets_, index);
+        }
+        adjacency_t reverse(index_t index) const {
+            return adjacency(reverse_offsets_, reverse_targets_, index);
+        }
+
+        //######################################################################
+        /// @return index's tags, sorted by key
+        const tags_t& tags(index_t index) const {
+            return tags_[index] ? *tags_[index] : no_tags_;
+        }
+
+        //######################################################################
+        /// @return values of key on index, or nullptr if it has no such tag
+        const std::vector<std::string>* tag(index_t index, const std::string &key) const;
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        struct read_t {                                                         ///< one node's row, before it's laid out
+            index_t index;
+            node_type type;                                                     ///< UNKNOWN if it isn't in the graph
+            std::vector<index_t> forward;
+            std::vector<index_t> reverse;
+            boost::shared_ptr<const tags_t> tags;
+        };
+
+        static const tags_t no_tags_;
+
+        uint64_t version_;
+        boost::shared_ptr<NameInterner> interner_;
+        std::vector<node_type> types_;                                          ///< UNKNOWN for ids not in the graph
+        std::vector<index_t> forward_offsets_;                                  ///< size() + 1 entries into forward_targets_
+        std::vector<index_t> forward_targets_;
+        std::vector<index_t> reverse_offsets_;                                  ///< size() + 1 entries into reverse_targets_
+        std::vector<index_t> reverse_targets_;
+        std::vector<boost::shared_ptr<const tags_t>> tags_;                     ///< nullptr for none; shared with older snapshots
+
+        //######################################################################
+        explicit CsrSnapshot(boost::shared_ptr<NameInterner> interner)
+            : version_(0), interner_(interner),
+            forward_offsets_(1, 0), reverse_offsets_(1, 0)
+        {
+        }
+
+        //######################################################################
+        /// @param[in] type node's type if known, else UNKNOWN to ask the node
+        /// @param[out] r name's row; interns it and its edges' names
+        /// @return false if name isn't in graph
+        bool read_node(const GraphInterface &graph, const std::string &name,
+                node_type type, read_t &r) const;
+
+        //######################################################################
+        /// @param[in] rows sorted by index; every other row is copied from
+        ///            this snapshot
+        /// @return this snapshot with rows replaced, labelled with version
+        boost::shared_ptr<const CsrSnapshot> replace_rows(uint64_t version,
+                std::vector<read_t> &&rows) const;
+
+        //######################################################################
+        static adjacency_t adjacency(const std::vector<index_t> &offsets,
+                const std::vector<index_t> &targets, index_t index) {
+            return adjacency_t(targets.data() + offsets[index],
+                    targets.data() + offsets[index + 1]);
+        }
+};
+
+} /* namespace graph */ } /* namespace range */
+
+#endif
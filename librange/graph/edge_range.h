@@ -0,0 +1,88 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _LIBRANGE_GRAPH__EDGE_RANGE_H
+#define _LIBRANGE_GRAPH__EDGE_RANGE_H
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/utility/string_ref.hpp>
+
+namespace range {
+namespace graph {
+
+class NodeIface;
+
+// #############################################################################
+/// The edges of one direction of a node, by name; a neighbour's node is only
+/// created when asked for with node().
+///
+/// The names refer into the node's own record, which the range keeps alive;
+/// they are valid for as long as the range is, unless the node is modified
+/// or given another wanted version in the meantime.
+class EdgeRange {
+    public:
+        typedef boost::shared_ptr<NodeIface> node_t;
+
+        //######################################################################
+        struct edge_t {
+            boost::string_ref name;                                             ///< neighbour's node name
+            uint64_t version;                                                   ///< list version of our node the edge was read at, or -1
+        };
+
+        typedef std::vector<edge_t>::const_iterator const_iterator;
+        typedef std::function<node_t(size_t index, boost::string_ref name)> make_node_t;
+
+        //######################################################################
+        EdgeRange() : owner_(), edges_(), make_node_() { }
+
+        //######################################################################
+        /// @param[in] owner keeps alive whatever edges' names refer into
+        /// @param[in] edges in edge order
+        /// @param[in] make_node creates the node for edges[index]
+        EdgeRange(boost::shared_ptr<const void> owner, std::vector<edge_t> &&edges,
+                make_node_t make_node)
+            : owner_(owner), edges_(std::move(edges)), make_node_(make_node)
+        {
+        }
+
+        //######################################################################
+        const_iterator begin() const { return edges_.begin(); }
+        const_iterator end() const { return edges_.end(); }
+        size_t size() const { return edges_.size(); }
+        bool empty() const { return edges_.empty(); }
+
+        //######################################################################
+        /// @return the neighbour at it, at the same wanted version as our node
+        node_t node(const_iterator it) const {
+            return make_node_(it - edges_.begin(), it->name);
+        }
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        boost::shared_ptr<const void> owner_;
+        std::vector<edge_t> edges_;
+        make_node_t make_node_;
+};
+
+} /* namespace graph */ } /* namespace range */
+
+#endif
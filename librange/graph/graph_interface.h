@@ -18,6 +18,7 @@
 #ifndef _LIBRANGE_GRAPH__GRAPH_INTERFACE_H
 #define _LIBRANGE_GRAPH__GRAPH_INTERFACE_H
 
+#include <map>
 #include <vector>
 #include <string>
 #include <boost/shared_ptr.hpp>
@@ -91,6 +92,32 @@ class GraphCursorInterface {
         /// @return the last node
         virtual node_t last() const = 0;
 
+        //######################################################################
+        /// @return true if next() visits nodes in name order, so that seek()
+        ///         and range() only touch the nodes asked for
+        virtual bool ordered() const { return false; }
+
+        //######################################################################
+        /// Set the cursor at the first node whose name is not less than name
+        /// (so that next() carries on from there, in name order if ordered()).
+        /// Cursors that aren't ordered() have to scan every node for this.
+        ///
+        /// @param name name, or leading part of a name, to seek to
+        /// @return that node, or nullptr if there is none
+        virtual node_t seek(const std::string& name) const;
+
+        //######################################################################
+        /// @param begin first name wanted (inclusive)
+        /// @param end name to stop at (exclusive); empty for no limit
+        /// @return nodes with begin <= name < end, in name order
+        virtual std::vector<node_t> range(const std::string& begin, const std::string& end) const;
+
+        //######################################################################
+        /// @param prefix leading part of the names wanted
+        /// @return the end to give range() for every name starting with
+        ///         prefix (empty if there is no limit)
+        static std::string prefix_end(const std::string& prefix);
+
     //##########################################################################
     //##########################################################################
     protected:
@@ -122,7 +149,8 @@ class GraphInterface
             NODE,                                                               ///< something like graph::NodeType
             GRAPH_META,                                                         ///< Metadata about the graph instance
             NODE_META,                                                          ///< Metadata about a node (do not inculcate record)
-            RESERVED=254,                                                       ///< 2-254 reserved for future
+            NODE_HISTORY,                                                       ///< Earlier list versions of a NODE (do not inculcate record)
+            RESERVED=254,                                                       ///< 4-254 reserved for future
             UNKNOWN=255,                                                        ///< Unknown type
         };
 
@@ -164,6 +192,44 @@ class GraphInterface
         /// @param name name of the node to fetch 
         /// @return node, or nullptr if node not found, throws on errors
         virtual node_t get_node(const std::string& name) const = 0;
+
+        //######################################################################
+        /// @param prefix leading part of the names wanted, e.g. "prod#"
+        /// @return names of the nodes starting with prefix (at the wanted
+        ///         version), in name order
+        virtual std::vector<std::string>
+            find_nodes_by_prefix(const std::string& prefix) const = 0;
+
+        //######################################################################
+        /// The default scans every node; implementations with an index
+        /// should override it.
+        ///
+        /// @param type node type wanted
+        /// @param version graph version to compare against
+        /// @return names of the nodes of type in the graph at version
+        virtual std::vector<std::string>
+            find_nodes_by_type(NodeIface::node_type type, uint64_t version) const;
+
+        //######################################################################
+        /// As find_nodes_by_type(), for every type at once
+        ///
+        /// @param version graph version to compare against
+        /// @return names of the nodes in the graph at version, by type
+        virtual std::map<NodeIface::node_type, std::vector<std::string>>
+            nodes_by_type(uint64_t version) const;
+
+        //######################################################################
+        /// The default scans every node; implementations with an index
+        /// should override it.
+        ///
+        /// @param key tag key
+        /// @param value one of the values wanted under key
+        /// @param version graph version to compare against
+        /// @return names of the nodes in the graph at version with value
+        ///         among key's values, in name order
+        virtual std::vector<std::string>
+            find_nodes_by_tag(const std::string& key, const std::string& value,
+                    uint64_t version) const;
  
         //######################################################################
         /// Note that for backends not supporting versioning, this should 
@@ -343,65 +409,25 @@ class version_filter {
         //######################################################################
         //######################################################################
         bool operator()(boost::shared_ptr<NodeIface> n) {
-            auto g_versions = n->graph_versions();
-
-            for (uint64_t node_version : boost::adaptors::reverse(g_versions)) {
-                if (node_version == wanted) {
-                    return true;
-                }
-                if (node_version < wanted) {                                    // we've gone too far back, bail out
-                    return false;
-                }
-            }
-            return false;                                                       // requested version is older than node
+            return n->live_at(wanted);
         }
 
         //######################################################################
         //######################################################################
         bool operator()(NodeIface& n) {
-            auto g_versions = n.graph_versions();
-
-            for (uint64_t node_version : boost::adaptors::reverse(g_versions)) {
-                if (node_version == wanted) {
-                    return true;
-                }
-                if (node_version < wanted) {                                    // we've gone too far back, bail out
-                    return false;
-                }
-            }
-            return false;                                                       // requested version is older than node
+            return n.live_at(wanted);
         }
 
         //######################################################################
         //######################################################################
         bool operator()(boost::shared_ptr<const NodeIface> n) {
-            auto g_versions = n->graph_versions();
-
-            for (uint64_t node_version : boost::adaptors::reverse(g_versions)) {
-                if (node_version == wanted) {
-                    return true;
-                }
-                if (node_version < wanted) {                                    // we've gone too far back, bail out
-                    return false;
-                }
-            }
-            return false;                                                       // requested version is older than node
+            return n->live_at(wanted);
         }
 
         //######################################################################
         //######################################################################
         bool operator()(const NodeIface& n) {
-            auto g_versions = n.graph_versions();
-
-            for (uint64_t node_version : boost::adaptors::reverse(g_versions)) {
-                if (node_version == wanted) {
-                    return true;
-                }
-                if (node_version < wanted) {                                    // we've gone too far back, bail out
-                    return false;
-                }
-            }
-            return false;                                                       // requested version is older than node
+            return n.live_at(wanted);
         }
 
 
@@ -14,6 +14,8 @@
  * You should have received a copy of the GNU General Public License
  * along with range++.  If not, see <http://www.gnu.org/licenses/>.
  */
+#include <algorithm>
+
 #include <boost/make_shared.hpp>
 
 #include "../core/log.h"
@@ -24,6 +26,122 @@
 namespace range {
 namespace graph {
 
+//##############################################################################
+// GraphCursorInterface
+//##############################################################################
+
+//##############################################################################
+GraphCursorInterface::node_t
+GraphCursorInterface::seek(const std::string& name) const
+{
+    BOOST_LOG_FUNCTION();
+    node_t found;
+    for (auto n = this->first(); n; n = this->next()) {
+        if (n->name() >= name && (!found || n->name() < found->name())) {
+            found = n;
+        }
+    }
+    if (found) {
+        this->fetch(found->name());
+    }
+    return found;
+}
+
+//##############################################################################
+std::vector<GraphCursorInterface::node_t>
+GraphCursorInterface::range(const std::string& begin, const std::string& end) const
+{
+    BOOST_LOG_FUNCTION();
+    std::vector<node_t> found;
+    if (this->ordered()) {
+        for (auto n = this->seek(begin); n && (end.empty() || n->name() < end); n = this->next()) {
+            found.push_back(n);
+        }
+        return found;
+    }
+
+    for (auto n = this->first(); n; n = this->next()) {
+        if (n->name() >= begin && (end.empty() || n->name() < end)) {
+            found.push_back(n);
+        }
+    }
+    std::sort(found.begin(), found.end(), [](const node_t &a, const node_t &b) { return a->name() < b->name(); });
+    return found;
+}
+
+//##############################################################################
+std::string
+GraphCursorInterface::prefix_end(const std::string& prefix)
+{
+    std::string end = prefix;
+    while (!end.empty() && static_cast<unsigned char>(end.back()) == 0xff) {   // can't be incremented; shorten it
+        end.pop_back();
+    }
+    if (!end.empty()) {
+        end.back() = static_cast<char>(static_cast<unsigned char>(end.back()) + 1);
+    }
+    return end;
+}
+
+//##############################################################################
+// GraphInterface
+//##############################################################################
+
+//##############################################################################
+std::vector<std::string>
+GraphInterface::find_nodes_by_type(NodeIface::node_type type, uint64_t version) const
+{
+    BOOST_LOG_FUNCTION();
+    std::vector<std::string> found;
+    auto first = makeVersionFilter(version, this->cbegin(), this->cend());
+    auto last = makeVersionFilter(version, this->cend(), this->cend());
+    for (auto it = first; it != last; ++it) {
+        if (it->type() == type) {
+            found.push_back(it->name());
+        }
+    }
+    return found;
+}
+
+//##############################################################################
+std::map<NodeIface::node_type, std::vector<std::string>>
+GraphInterface::nodes_by_type(uint64_t version) const
+{
+    BOOST_LOG_FUNCTION();
+    std::map<NodeIface::node_type, std::vector<std::string>> found;
+    auto first = makeVersionFilter(version, this->cbegin(), this->cend());
+    auto last = makeVersionFilter(version, this->cend(), this->cend());
+    for (auto it = first; it != last; ++it) {
+        found[it->type()].push_back(it->name());
+    }
+    return found;
+}
+
+//##############################################################################
+std::vector<std::string>
+GraphInterface::find_nodes_by_tag(const std::string& key, const std::string& value,
+        uint64_t version) const
+{
+    BOOST_LOG_FUNCTION();
+    std::vector<std::string> found;
+    auto first = makeVersionFilter(version, this->cbegin(), this->cend());
+    auto last = makeVersionFilter(version, this->cend(), this->cend());
+    for (auto it = first; it != last; ++it) {
+        auto node = this->get_node(it->name());                                 // at this graph's version, not the cursor's
+        if (!node) {
+            continue;
+        }
+        auto tags = node->tags();
+        auto values = tags.find(key);
+        if (values != tags.end()
+                && std::find(values->second.begin(), values->second.end(), value) != values->second.end()) {
+            found.push_back(it->name());
+        }
+    }
+    std::sort(found.begin(), found.end());
+    return found;
+}
+
 //##############################################################################
 // GraphIterator
 //##############################################################################
@@ -19,10 +19,11 @@
 #include <iterator>
 #include <algorithm>
 
-#include <boost/range/adaptor/reversed.hpp>
 #include <boost/lexical_cast.hpp>
 
 #include "../db/db_exceptions.h"
+#include "../db/node_tag_index.h"
+#include "../db/node_type_index.h"
 #include "graphdb.h"
 
 namespace range { namespace graph {
@@ -125,28 +126,109 @@ GraphDB::get_node(const std::string& name) const
     uint64_t cmp_version = (static_cast<int64_t>(wanted_version_) == -1)
         ? this_version : wanted_version_;
 
-    auto g_versions = n->graph_versions();
-
-    for (uint64_t node_version : boost::adaptors::reverse(g_versions)) {
-        if (node_version == cmp_version) {
-            LOG(debug8, "found_wanted_version") << name;
-            if (cmp_version != this_version) {
-                auto it = node_version_map.find(name);
-                if (it != node_version_map.end()) {
-                    LOG(debug8, "setting_node_wanted_version") << name << ": " << it->second; 
-                    n->set_wanted_version(it->second);
-                }
+    if (n->live_at(cmp_version)) {
+        LOG(debug8, "found_wanted_version") << name;
+        if (cmp_version != this_version) {
+            uint64_t object_version = this->node_version_at(name, cmp_version);
+            if (object_version != static_cast<uint64_t>(-1)) {
+                LOG(debug8, "setting_node_wanted_version") << name << ": " << object_version;
+                n->set_wanted_version(object_version);
             }
-            return n;
-        }
-        if (node_version < cmp_version) {                                   // we've gone too far back, bail out
-            break;
         }
+        return n;
     }
     LOG(debug4, "node_incorrect_version") << name;
     return nullptr;
 }
 
+//##############################################################################
+// A range scan; on an ordered (DB_BTREE) instance this reads only the
+// matching nodes.
+//##############################################################################
+std::vector<std::string>
+GraphDB::find_nodes_by_prefix(const std::string& prefix) const
+{
+    RANGE_LOG_TIMED_FUNCTION() << "prefix: " << prefix;
+    uint64_t cmp_version = (static_cast<int64_t>(wanted_version_) == -1)
+        ? this->version() : wanted_version_;
+
+    std::vector<std::string> names;
+    auto cur = get_cursor();
+    for (auto &n : cur->range(prefix, GraphCursorInterface::prefix_end(prefix))) {
+        if (n->live_at(cmp_version)) {
+            names.push_back(n->name());
+        }
+    }
+    return names;
+}
+
+//##############################################################################
+// Versions from before the graph was indexed fall back to a scan
+//##############################################################################
+std::vector<std::string>
+GraphDB::find_nodes_by_type(NodeIface::node_type type, uint64_t version) const
+{
+    RANGE_LOG_TIMED_FUNCTION() << NodeIface::node_type_names.find(type)->second << ": " << version;
+    db::NodeTypeIndex index { instance_ };
+    if (version >= index.complete_from()) {
+        return index.find(type, version);
+    }
+    LOG(debug1, "type_index_incomplete") << name_ << ": " << version;
+    return GraphInterface::find_nodes_by_type(type, version);
+}
+
+//##############################################################################
+//##############################################################################
+std::map<NodeIface::node_type, std::vector<std::string>>
+GraphDB::nodes_by_type(uint64_t version) const
+{
+    RANGE_LOG_TIMED_FUNCTION() << version;
+    db::NodeTypeIndex index { instance_ };
+    if (version >= index.complete_from()) {
+        std::map<NodeIface::node_type, std::vector<std::string>> found;
+        for (auto &type : NodeIface::node_type_names) {
+            auto names = index.find(type.first, version);
+            if (!names.empty()) {
+                found[type.first] = std::move(names);
+            }
+        }
+        return found;
+    }
+    LOG(debug1, "type_index_incomplete") << name_ << ": " << version;
+    return GraphInterface::nodes_by_type(version);
+}
+
+//##############################################################################
+//##############################################################################
+std::vector<std::string>
+GraphDB::find_nodes_by_tag(const std::string& key, const std::string& value, uint64_t version) const
+{
+    RANGE_LOG_TIMED_FUNCTION() << key << "=" << value << ": " << version;
+    db::NodeTagIndex index { instance_ };
+    if (version >= index.complete_from()) {
+        return index.find(key, value, version);
+    }
+    LOG(debug1, "tag_index_incomplete") << name_ << ": " << version;
+    return GraphInterface::find_nodes_by_tag(key, value, version);
+}
+
+//##############################################################################
+// Only the nodes we're asked for are looked up; and only once per wanted
+// version.
+//##############################################################################
+uint64_t
+GraphDB::node_version_at(const std::string& name, uint64_t version) const
+{
+    BOOST_LOG_FUNCTION();
+    auto it = node_version_map.find(name);
+    if (it != node_version_map.end()) {
+        return it->second;
+    }
+    uint64_t object_version = instance_->node_version_at(name, version);
+    node_version_map[name] = object_version;
+    return object_version;
+}
+
 //##############################################################################
 //##############################################################################
 GraphDB::iterator_t
@@ -214,26 +296,21 @@ bool
 GraphDB::has_version_or_higher(uint64_t wanted_version, node_t node)
 {
     BOOST_LOG_FUNCTION();
-    auto vers = node->graph_versions();
-    for (uint64_t node_version : boost::adaptors::reverse(vers)) {
-        if(node_version > wanted_version) {
-            LOG(debug9, "node_greater_than_wanted_version") << node->name() << ": " << node_version << " " << wanted_version;
-            return true;
-        }
-        if (node_version == wanted_version) {
-            LOG(debug9, "node_equal_to_wanted_version") << node->name() << ": " << node_version << " " << wanted_version;
-            return true;
-        }
-        if (node_version < wanted_version) {
-            LOG(debug9, "node_less_than_wanted_version") << node->name() << ": " << node_version << " " << wanted_version;
-            return false;
-        }
+    if (node->live_at_or_after(wanted_version)) {
+        LOG(debug9, "node_at_or_after_wanted_version") << node->name() << ": " << wanted_version;
+        return true;
     }
+    LOG(debug9, "node_less_than_wanted_version") << node->name() << ": " << wanted_version;
     return false;
 }
 
 
 //##############################################################################
+// A node stays live from the version it was added at until it is removed, so
+// a commit only has to close the intervals of the nodes it removed; nodes it
+// created were already added at this version by create(). Nodes that nobody
+// touched are implicitly live at the new version, which keeps the cost of a
+// commit proportional to what it changed rather than to the size of the graph.
 //##############################################################################
 void
 GraphDB::update_versions(uint64_t prior_version)
@@ -241,6 +318,39 @@ GraphDB::update_versions(uint64_t prior_version)
     RANGE_LOG_TIMED_FUNCTION() << prior_version;
     auto lock = instance_->write_lock(db::GraphInstanceInterface::record_type::NODE_META, "");
     auto txn = instance_->start_txn();
+
+    if (!live_intervals_complete()) {
+        extend_live_nodes(prior_version);
+    }
+
+    for (auto &removed : removed_nodes) {
+        LOG(debug1, "removed_node") << removed.first << " at version: " << this->version();
+        node_t update_node = this->node_factory_->createNode(removed.first, instance_);
+        update_node->remove_graph_version(this->version());
+    }
+    removed_nodes.clear();
+}
+
+//##############################################################################
+// Set once every node in the graph has been carried forward as an interval
+//##############################################################################
+bool
+GraphDB::live_intervals_complete() const
+{
+    BOOST_LOG_FUNCTION();
+    return !instance_->get_record(db::GraphInstanceInterface::record_type::GRAPH_META,
+            "live_intervals").empty();
+}
+
+//##############################################################################
+// One-time pass for graphs written before node liveness was kept as open
+// intervals: nodes which only list the versions they were part of have to be
+// carried forward explicitly, once, after which they stay live on their own.
+//##############################################################################
+void
+GraphDB::extend_live_nodes(uint64_t prior_version)
+{
+    RANGE_LOG_TIMED_FUNCTION() << prior_version;
     std::vector<std::string> nodes_requiring_update;
 
     // FIXME: the non-const iterator is completely broken; the cursor implementation invalidates the iterator
@@ -248,20 +358,20 @@ GraphDB::update_versions(uint64_t prior_version)
     //          must figure out a way to have a non-const iterator that works
     for (auto &n : *this) {
         if(has_version_or_higher(prior_version, boost::shared_ptr<NodeIface>(&n, [](void *) { return nullptr; }))) {
-            auto it = removed_nodes.find(n.name());
-            if(it != removed_nodes.end()) {
-                LOG(debug1, "removed_node") << n.name() << " at version: " << this->version();
-                continue;
+            if(removed_nodes.find(n.name()) == removed_nodes.end()) {
+                nodes_requiring_update.push_back(n.name());
             }
-            nodes_requiring_update.push_back(n.name());
         }
     }
-    removed_nodes.clear();
     for (std::string node_name : nodes_requiring_update) {
         node_t update_node = this->node_factory_->createNode(node_name, instance_);
         update_node->add_graph_version(this->version());
-        update_node->commit();
     }
+
+    LOG(info, "live_intervals_complete") << name_ << ": " << nodes_requiring_update.size()
+        << " nodes at version " << this->version();
+    instance_->write_record(db::GraphInstanceInterface::record_type::GRAPH_META, "live_intervals", 0,
+            boost::lexical_cast<std::string>(this->version()));
 }
 
 //##############################################################################
@@ -283,36 +393,6 @@ GraphDB::set_wanted_version(uint64_t ver)
 
     if (ver <= version()) {
         wanted_version_ = ver;
-
-        node_version_map.reserve(instance_->n_vertices());
-
-        auto changehistory = instance_->get_change_history();
-        uint64_t v = version();
-
-        if (changehistory.size() != v) {
-            std::stringstream s;
-            s << "changehistory inconsistent with graph version, found: "
-                << changehistory.size() << ", expected " << v;
-            THROW_STACK(db::DatabaseVersioningError(s.str()));
-        }
-
-        auto it = changehistory.rbegin();
-
-        while (v >= ver) {
-            for (auto change : *it) {
-                record_type type;
-                std::string node_name;
-                uint64_t node_version;
-                std::string data;
-                std::tie(type, node_name, node_version, data) = change;
-
-                if(type != record_type::NODE) { continue; }
-
-                node_version_map[node_name] = node_version;
-            }
-            --v;
-            ++it;
-        } 
         return true;
     }
     return false;
@@ -333,15 +413,8 @@ GraphDB::node_t
 GraphDB::remove(node_t node)
 {
     BOOST_LOG_FUNCTION();
-    auto vers = node->graph_versions();
-
-    for (auto it = vers.rbegin(); it != vers.rend(); ++it) {
-        if (*it == this->version()) {
-            break;
-        }
-        if (*it < this->version()) {
-            return nullptr;
-        }
+    if (!node->live_at_or_after(this->version())) {
+        return nullptr;
     }
 
     auto txn = instance_->start_txn();
@@ -145,6 +145,11 @@ class GraphDB
 
         //######################################################################
         virtual node_t get_node(const std::string& name) const override;
+        virtual std::vector<std::string> find_nodes_by_prefix(const std::string& prefix) const override;
+        virtual std::vector<std::string> find_nodes_by_type(NodeIface::node_type type, uint64_t version) const override;
+        virtual std::map<NodeIface::node_type, std::vector<std::string>> nodes_by_type(uint64_t version) const override;
+        virtual std::vector<std::string> find_nodes_by_tag(const std::string& key, const std::string& value,
+                uint64_t version) const override;
 
         virtual graph::const_GraphIterator cbegin() const override;
         virtual graph::const_GraphIterator cend() const override;
@@ -183,8 +188,11 @@ class GraphDB
         instance_t instance_;
         uint64_t wanted_version_;
         node_factory_t node_factory_;
-        std::unordered_map<std::string, uint64_t> node_version_map;
+        mutable std::unordered_map<std::string, uint64_t> node_version_map;    ///< object versions at wanted_version_, filled as nodes are read
         bool has_version_or_higher(uint64_t wanted_version, node_t node);
+        uint64_t node_version_at(const std::string& name, uint64_t version) const;
+        bool live_intervals_complete() const;
+        void extend_live_nodes(uint64_t prior_version);
         std::unordered_map<std::string, bool> removed_nodes;
         //std::vector<boost::shared_ptr<graph::NodeIface>> removed_nodes;
         range::Emitter log;
@@ -0,0 +1,208 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <algorithm>
+#include <stack>
+
+#include "host_closure.h"
+#include "../db/db_interface.h"
+
+namespace range { namespace graph {
+
+typedef NodeIface::node_type node_type;
+
+//##############################################################################
+//##############################################################################
+boost::shared_ptr<HostClosure>
+HostClosure::get(db::BackendInterface &backend, const std::string &graph)
+{
+    return backend.graph_state<HostClosure>(graph, [&backend, &graph]() {
+                return boost::make_shared<HostClosure>(NameInterner::get(backend, graph));
+            });
+}
+
+//##############################################################################
+//##############################################################################
+HostClosure::HostClosure(boost::shared_ptr<NameInterner> interner)
+    : lock_(), interner_(interner), through_(0), memo_(), watchers_()
+{
+}
+
+//##############################################################################
+//##############################################################################
+const HostClosure::entry_t*
+HostClosure::find(id_t id, uint64_t version) const
+{
+    if (version > through_) {
+        return nullptr;
+    }
+    auto it = memo_.find(id);
+    if (it == memo_.end() || version < it->second.version || version >= it->second.until) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+//##############################################################################
+//##############################################################################
+void
+HostClosure::unwatch(id_t root, const entry_t &e)
+{
+    for (auto m : *e.members) {
+        auto it = watchers_.find(m);
+        if (it != watchers_.end()) {
+            it->second.erase(root);
+            if (it->second.empty()) {
+                watchers_.erase(it);
+            }
+        }
+    }
+}
+
+//##############################################################################
+//##############################################################################
+HostClosure::ids_t
+HostClosure::hosts(IdAdjacency &adj, id_t id, uint64_t version)
+{
+    {
+        std::lock_guard<std::mutex> guard { lock_ };
+        if (auto e = find(id, version)) {
+            return e->hosts;
+        }
+    }
+
+    auto hosts = boost::make_shared<std::vector<id_t>>();
+    auto members = boost::make_shared<std::vector<id_t>>();
+    IdSet visited;
+    std::stack<id_t> st;
+    st.push(id);
+    while (!st.empty()) {
+        auto v = st.top(); st.pop();
+        if (!visited.insert(v)) {
+            continue;
+        }
+        if (v != id) {                                                          // a closure below us we already have
+            ids_t below_hosts, below_members;
+            {
+                std::lock_guard<std::mutex> guard { lock_ };
+                if (auto e = find(v, version)) {
+                    below_hosts = e->hosts;
+                    below_members = e->members;
+                }
+            }
+            if (below_hosts) {
+                hosts->insert(hosts->end(), below_hosts->begin(), below_hosts->end());
+                members->insert(members->end(), below_members->begin(), below_members->end());
+                continue;
+            }
+        }
+        members->push_back(v);
+        switch (adj.type(v)) {
+            case node_type::HOST:
+                hosts->push_back(v);
+                break;
+            case node_type::CLUSTER:
+            case node_type::ENVIRONMENT:
+                for (auto e : adj.forward(v)) {
+                    if (!visited.contains(e)) {
+                        st.push(e);
+                    }
+                }
+                break;
+            default:
+                break;
+        }
+    }
+    std::sort(hosts->begin(), hosts->end());
+    hosts->erase(std::unique(hosts->begin(), hosts->end()), hosts->end());
+    std::sort(members->begin(), members->end());
+    members->erase(std::unique(members->begin(), members->end()), members->end());
+
+    std::lock_guard<std::mutex> guard { lock_ };
+    if (version == through_) {                                                  // older ones' changes are already gone by
+        auto old = memo_.find(id);
+        if (old != memo_.end()) {
+            unwatch(id, old->second);
+        }
+        memo_[id] = entry_t { version, static_cast<uint64_t>(-1), hosts, members };
+        for (auto m : *members) {
+            watchers_[m].insert(id);
+        }
+    }
+    return hosts;
+}
+
+//##############################################################################
+//##############################################################################
+void
+HostClosure::reset(uint64_t version)
+{
+    std::lock_guard<std::mutex> guard { lock_ };
+    memo_.clear();
+    watchers_.clear();
+    through_ = version;
+}
+
+//##############################################################################
+//##############################################################################
+void
+HostClosure::changed(uint64_t version, const std::vector<std::string> &nodes)
+{
+    std::lock_guard<std::mutex> guard { lock_ };
+    for (auto &name : nodes) {
+        auto id = interner_->find(name);
+        if (id == NameInterner::npos) {                                         // no closure was made from it
+            continue;
+        }
+        auto it = watchers_.find(id);
+        if (it == watchers_.end()) {
+            continue;
+        }
+        std::vector<id_t> roots { it->second.begin(), it->second.end() };       // unwatch() changes it
+        for (auto root : roots) {
+            auto m = memo_.find(root);
+            if (m == memo_.end()) {
+                continue;
+            }
+            if (m->second.until > version) {
+                m->second.until = version;
+            }
+            unwatch(root, m->second);                                           // from every member, not just this one
+        }
+    }
+    through_ = version;
+}
+
+//##############################################################################
+//##############################################################################
+uint64_t
+HostClosure::through() const
+{
+    std::lock_guard<std::mutex> guard { lock_ };
+    return through_;
+}
+
+//##############################################################################
+//##############################################################################
+size_t
+HostClosure::watchers(id_t id) const
+{
+    std::lock_guard<std::mutex> guard { lock_ };
+    auto it = watchers_.find(id);
+    return (it == watchers_.end()) ? 0 : it->second.size();
+}
+
+} /* namespace graph */ } /* namespace range */
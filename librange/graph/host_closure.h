@@ -0,0 +1,112 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _LIBRANGE_GRAPH__HOST_CLOSURE_H
+#define _LIBRANGE_GRAPH__HOST_CLOSURE_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include "id_adjacency.h"
+#include "name_interner.h"
+
+namespace range { namespace graph {
+
+//##############################################################################
+/// The hosts under each node of a graph: every HOST reached from it through
+/// the forward edges of clusters and environments, as expand_hosts() wants.
+///
+/// Each node's closure is remembered along with the versions it holds for,
+/// and reused, whole, by the closures of the nodes above it. When a version
+/// changes some nodes (see changed()), only the closures that were computed
+/// from one of them stop being used.
+class HostClosure {
+    public:
+        typedef NameInterner::id_t id_t;
+        typedef boost::shared_ptr<const std::vector<id_t>> ids_t;
+
+        //######################################################################
+        /// @param[in] backend the graph's backend, which keeps the closures
+        /// @param[in] graph name of the graph instance, e.g. "primary"
+        /// @return the closures for graph
+        static boost::shared_ptr<HostClosure> get(db::BackendInterface &backend,
+                const std::string &graph);
+
+        //######################################################################
+        explicit HostClosure(boost::shared_ptr<NameInterner> interner);
+
+        //######################################################################
+        /// @param[in] adj the graph at version
+        /// @param[in] id node to start from; itself if it is a HOST
+        /// @param[in] version graph version adj reads; remembered closures
+        ///            are used for versions up to through(), and only made
+        ///            at through()
+        /// @return ids of the hosts, sorted by id
+        ids_t hosts(IdAdjacency &adj, id_t id, uint64_t version);
+
+        //######################################################################
+        /// Forget everything, and take the graph as known up to version
+        void reset(uint64_t version);
+
+        //######################################################################
+        /// Version changed nodes; must be told of every version, in order,
+        /// after the one given to reset()
+        void changed(uint64_t version, const std::vector<std::string> &nodes);
+
+        //######################################################################
+        /// @return last version the closures know the changes of
+        uint64_t through() const;
+
+        //######################################################################
+        /// @return number of remembered closures a change to id would stop
+        size_t watchers(id_t id) const;
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        struct entry_t {
+            uint64_t version;                                                   ///< computed at
+            uint64_t until;                                                     ///< first version it doesn't hold for, or -1
+            ids_t hosts;
+            ids_t members;                                                      ///< every node it was computed from, sorted
+        };
+
+        mutable std::mutex lock_;
+        boost::shared_ptr<NameInterner> interner_;
+        uint64_t through_;
+        std::unordered_map<id_t, entry_t> memo_;
+        std::unordered_map<id_t, std::unordered_set<id_t>> watchers_;           ///< node -> closures computed from it
+
+        //######################################################################
+        /// MUST HOLD lock_
+        const entry_t* find(id_t id, uint64_t version) const;
+
+        //######################################################################
+        /// Stop watching e's members for changes to root's closure.
+        /// MUST HOLD lock_
+        void unwatch(id_t root, const entry_t &e);
+};
+
+} /* namespace graph */ } /* namespace range */
+
+#endif
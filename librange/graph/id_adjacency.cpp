@@ -0,0 +1,76 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "id_adjacency.h"
+
+namespace range { namespace graph {
+
+//##############################################################################
+//##############################################################################
+IdAdjacency::entry_t&
+IdAdjacency::load(id_t id)
+{
+    auto it = nodes_.find(id);
+    if (it != nodes_.end()) {
+        return it->second;
+    }
+    entry_t &entry = nodes_[id];
+    auto node = graph_->get_node(interner_->name(id));
+    entry.present = static_cast<bool>(node);
+    entry.type = node ? node->type() : node_type::UNKNOWN;
+    entry.reverse_loaded = !node;
+    if (node) {
+        intern_edges(node->forward_edge_range(), &entry.forward);
+    }
+    return entry;
+}
+
+//##############################################################################
+//##############################################################################
+void
+IdAdjacency::intern_edges(const EdgeRange &edges, std::vector<id_t> *ids)
+{
+    ids->reserve(edges.size());
+    for (auto &edge : edges) {
+        ids->push_back(interner_->intern(edge.name));
+    }
+}
+
+//##############################################################################
+//##############################################################################
+const std::vector<IdAdjacency::id_t>&
+IdAdjacency::forward(id_t id)
+{
+    return load(id).forward;
+}
+
+//##############################################################################
+// Read again, rather than holding every node against a call that seldom comes
+//##############################################################################
+const std::vector<IdAdjacency::id_t>&
+IdAdjacency::reverse(id_t id)
+{
+    entry_t &entry = load(id);
+    if (!entry.reverse_loaded) {
+        if (auto node = graph_->get_node(interner_->name(id))) {
+            intern_edges(node->reverse_edge_range(), &entry.reverse);
+        }
+        entry.reverse_loaded = true;
+    }
+    return entry.reverse;
+}
+
+} /* namespace graph */ } /* namespace range */
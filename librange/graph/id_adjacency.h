@@ -0,0 +1,128 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _LIBRANGE_GRAPH__ID_ADJACENCY_H
+#define _LIBRANGE_GRAPH__ID_ADJACENCY_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
+
+#include "graph_interface.h"
+#include "name_interner.h"
+
+namespace range { namespace graph {
+
+//##############################################################################
+/// Set of interned node ids, one bit per id
+class IdSet {
+    public:
+        typedef NameInterner::id_t id_t;
+
+        //######################################################################
+        /// @return true if id was not in the set yet
+        bool insert(id_t id) {
+            size_t word = id / 64;
+            if (word >= words_.size()) {
+                words_.resize(word + 1, 0);
+            }
+            uint64_t bit = uint64_t(1) << (id % 64);
+            if (words_[word] & bit) {
+                return false;
+            }
+            words_[word] |= bit;
+            return true;
+        }
+
+        //######################################################################
+        bool contains(id_t id) const {
+            size_t word = id / 64;
+            return word < words_.size() && (words_[word] >> (id % 64)) & 1;
+        }
+
+        //######################################################################
+        void clear() { words_.clear(); }
+
+    private:
+        std::vector<uint64_t> words_;
+};
+
+//##############################################################################
+/// A graph (at its wanted version) seen through interned node ids: each
+/// node's type and forward edges, as ids, read the first time either is asked
+/// for; its reverse edges the first time they are. The node itself isn't
+/// kept, so a traversal holds ids, not records, for what it has seen.
+///
+/// Meant to live for one traversal; it doesn't see changes made to the
+/// graph after a node was read.
+class IdAdjacency {
+    public:
+        typedef NameInterner::id_t id_t;
+        typedef NodeIface::node_type node_type;
+        typedef boost::shared_ptr<GraphInterface> graph_t;
+
+        //######################################################################
+        IdAdjacency(graph_t graph, boost::shared_ptr<NameInterner> interner)
+            : graph_(graph), interner_(interner), nodes_()
+        {
+        }
+
+        //######################################################################
+        id_t id(const std::string &name) { return interner_->intern(name); }
+        const std::string& name(id_t id) const { return interner_->name(id); }
+
+        //######################################################################
+        /// @return true if id's node is in the graph
+        bool present(id_t id) { return load(id).present; }
+
+        //######################################################################
+        /// @return type of id's node, UNKNOWN if it isn't in the graph
+        node_type type(id_t id) { return load(id).type; }
+
+        //######################################################################
+        /// @return ids of id's forward edges, in edge order
+        const std::vector<id_t>& forward(id_t id);
+
+        //######################################################################
+        /// @return ids of id's reverse edges, in edge order
+        const std::vector<id_t>& reverse(id_t id);
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        struct entry_t {
+            bool present;
+            node_type type;
+            bool reverse_loaded;
+            std::vector<id_t> forward;
+            std::vector<id_t> reverse;
+        };
+
+        graph_t graph_;
+        boost::shared_ptr<NameInterner> interner_;
+        std::unordered_map<id_t, entry_t> nodes_;
+
+        //######################################################################
+        entry_t& load(id_t id);
+        void intern_edges(const EdgeRange &edges, std::vector<id_t> *ids);
+};
+
+} /* namespace graph */ } /* namespace range */
+
+#endif
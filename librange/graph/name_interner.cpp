@@ -0,0 +1,84 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <boost/make_shared.hpp>
+
+#include "name_interner.h"
+#include "../db/db_interface.h"
+
+namespace range { namespace graph {
+
+const NameInterner::id_t NameInterner::npos;
+
+//##############################################################################
+//##############################################################################
+boost::shared_ptr<NameInterner>
+NameInterner::get(db::BackendInterface &backend, const std::string &graph)
+{
+    return backend.graph_state<NameInterner>(graph, []() {
+                return boost::make_shared<NameInterner>();
+            });
+}
+
+//##############################################################################
+//##############################################################################
+NameInterner::id_t
+NameInterner::intern(boost::string_ref name)
+{
+    id_t id = find(name);
+    if (id != npos) {
+        return id;
+    }
+    boost::unique_lock<boost::shared_mutex> guard { lock_ };
+    auto it = ids_.find(name);                                                  // someone may have added it meanwhile
+    if (it != ids_.end()) {
+        return it->second;
+    }
+    id = names_.size();
+    names_.push_back(name.to_string());
+    ids_.emplace(names_.back(), id);
+    return id;
+}
+
+//##############################################################################
+//##############################################################################
+NameInterner::id_t
+NameInterner::find(boost::string_ref name) const
+{
+    boost::shared_lock<boost::shared_mutex> guard { lock_ };
+    auto it = ids_.find(name);
+    return (it == ids_.end()) ? npos : it->second;
+}
+
+//##############################################################################
+//##############################################################################
+const std::string&
+NameInterner::name(id_t id) const
+{
+    boost::shared_lock<boost::shared_mutex> guard { lock_ };
+    return names_.at(id);
+}
+
+//##############################################################################
+//##############################################################################
+size_t
+NameInterner::size() const
+{
+    boost::shared_lock<boost::shared_mutex> guard { lock_ };
+    return names_.size();
+}
+
+} /* namespace graph */ } /* namespace range */
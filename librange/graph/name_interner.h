@@ -0,0 +1,88 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef _LIBRANGE_GRAPH__NAME_INTERNER_H
+#define _LIBRANGE_GRAPH__NAME_INTERNER_H
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <unordered_map>
+
+#include <boost/shared_ptr.hpp>
+#include <boost/functional/hash.hpp>
+#include <boost/thread/shared_mutex.hpp>
+#include <boost/utility/string_ref.hpp>
+
+namespace range { namespace db { class BackendInterface; } }
+
+namespace range { namespace graph {
+
+//##############################################################################
+/// In-memory map from the node names of one graph to dense 32-bit ids, so
+/// that traversals can mark and compare nodes by number.
+///
+/// Ids are handed out in the order names are first seen, are never reused,
+/// and stay the same for the life of the backend, whatever the graph
+/// version; a name that has since left the graph keeps its id.
+///
+/// Readers share the lock; it's only taken exclusively to add a name.
+class NameInterner {
+    public:
+        typedef uint32_t id_t;
+        static const id_t npos = static_cast<id_t>(-1);
+
+        //######################################################################
+        /// @param[in] backend the graph's backend, which keeps the interner
+        /// @param[in] graph name of the graph instance, e.g. "primary"
+        /// @return the interner for graph
+        static boost::shared_ptr<NameInterner> get(db::BackendInterface &backend,
+                const std::string &graph);
+
+        //######################################################################
+        /// @return name's id, assigning the next one if it has none yet
+        id_t intern(boost::string_ref name);
+
+        //######################################################################
+        /// @return name's id, or npos if it has none; never adds one
+        id_t find(boost::string_ref name) const;
+
+        //######################################################################
+        /// @return the name id was assigned to; valid for the life of the
+        ///         interner
+        const std::string& name(id_t id) const;
+
+        //######################################################################
+        /// @return number of ids assigned; every id is below this
+        size_t size() const;
+
+    //##########################################################################
+    //##########################################################################
+    private:
+        struct hash_t {
+            size_t operator()(boost::string_ref s) const {
+                return boost::hash_range(s.begin(), s.end());
+            }
+        };
+
+        mutable boost::shared_mutex lock_;
+        std::deque<std::string> names_;                                         ///< by id; a deque, so they never move
+        std::unordered_map<boost::string_ref, id_t, hash_t> ids_;               ///< keys refer into names_
+};
+
+} /* namespace graph */ } /* namespace range */
+
+#endif
@@ -15,6 +15,8 @@
  * along with range++.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <boost/make_shared.hpp>
+
 #include "node_interface.h"
 
 namespace range { namespace graph {
@@ -29,4 +31,44 @@ const std::map<node_type, std::string> NodeIface::node_type_names = {
     {node_type::UNKNOWN, "UNKNOWN"}
 };
 
+//##############################################################################
+//##############################################################################
+static EdgeRange
+make_edge_range(std::vector<NodeIface::node_t> &&nodes)
+{
+    struct owner_t {
+        std::vector<NodeIface::node_t> nodes;
+        std::vector<std::string> names;
+    };
+    auto owner = boost::make_shared<owner_t>();
+    owner->nodes = std::move(nodes);
+    owner->names.reserve(owner->nodes.size());
+
+    std::vector<EdgeRange::edge_t> edges;
+    edges.reserve(owner->nodes.size());
+    for (auto &n : owner->nodes) {
+        owner->names.push_back(n->name());
+        edges.push_back({ owner->names.back(), static_cast<uint64_t>(-1) });
+    }
+    owner_t *o = owner.get();                                                   // alive as long as the range is
+    return EdgeRange(owner, std::move(edges),
+            [o](size_t index, boost::string_ref) { return o->nodes[index]; });
+}
+
+//##############################################################################
+//##############################################################################
+EdgeRange
+NodeIface::forward_edge_range() const
+{
+    return make_edge_range(forward_edges());
+}
+
+//##############################################################################
+//##############################################################################
+EdgeRange
+NodeIface::reverse_edge_range() const
+{
+    return make_edge_range(reverse_edges());
+}
+
 } /* namespace graph */ } /* namespace range */
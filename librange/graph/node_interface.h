@@ -24,6 +24,8 @@
 #include <unordered_map>
 #include <boost/shared_ptr.hpp>
 
+#include "edge_range.h"
+
 namespace range {
 namespace graph { 
 
@@ -79,6 +81,18 @@ class NodeIface {
         /// @return reverse edges
         virtual std::vector<node_t> reverse_edges() const = 0;
 
+        //######################################################################
+        /// For callers that mostly want the neighbours' names; the default
+        /// creates the nodes up front, implementations should only do so on
+        /// EdgeRange::node()
+        ///
+        /// @return forward edges
+        virtual EdgeRange forward_edge_range() const;
+
+        //######################################################################
+        /// @return reverse edges, as forward_edge_range()
+        virtual EdgeRange reverse_edge_range() const;
+
         //######################################################################
         /// @return the name of the node
         virtual std::string name() const = 0;
@@ -187,10 +201,49 @@ class NodeIface {
         /// @return true on success, false on error, (or throw)
         virtual bool commit() = 0;
 
+        //######################################################################
+        /// The node is part of the graph from version on, until
+        /// remove_graph_version(); GraphDB doesn't revisit nodes that a commit
+        /// didn't touch, so they must stay live at later versions on their own.
+        ///
+        /// @param version graph version the node was added in
         virtual void add_graph_version(uint64_t version) = 0;
         virtual std::vector<uint64_t> graph_versions() const = 0;
         virtual void shutdown() = 0;
 
+        //######################################################################
+        /// The node is no longer part of the graph as of version.
+        ///
+        /// @param version graph version the node was removed in
+        virtual void remove_graph_version(uint64_t version) {
+            (void)version;
+        }
+
+        //######################################################################
+        /// @param version graph version
+        /// @return true if the node is part of the graph at version
+        virtual bool live_at(uint64_t version) const {
+            auto vers = this->graph_versions();
+            for (auto it = vers.rbegin(); it != vers.rend(); ++it) {
+                if (*it == version) {
+                    return true;
+                }
+                if (*it < version) {
+                    break;
+                }
+            }
+            return false;
+        }
+
+        //######################################################################
+        /// @param version graph version
+        /// @return true if the node is part of the graph at version, or any
+        ///         later one
+        virtual bool live_at_or_after(uint64_t version) const {
+            auto vers = this->graph_versions();
+            return !vers.empty() && vers.back() >= version;
+        }
+
 
     //##########################################################################
     //##########################################################################
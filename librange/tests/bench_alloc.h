@@ -0,0 +1,55 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+//##############################################################################
+// Allocation counting for the benchmarks. Replaces the global operator new, so
+// include this from exactly one translation unit of each benchmark program.
+// Only counts what goes through operator new (BerkeleyDB's own mallocs are not
+// included).
+//##############################################################################
+#ifndef _RANGE_TESTS_BENCH_ALLOC_H
+#define _RANGE_TESTS_BENCH_ALLOC_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<uint64_t> alloc_bytes { 0 };
+static std::atomic<uint64_t> alloc_count { 0 };
+
+//##############################################################################
+//##############################################################################
+static void *
+counted_alloc(size_t n)
+{
+    alloc_bytes += n;
+    ++alloc_count;
+    void * p = std::malloc(n ? n : 1);
+    if(!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void * operator new(size_t n) { return counted_alloc(n); }
+void * operator new[](size_t n) { return counted_alloc(n); }
+void operator delete(void * p) noexcept { std::free(p); }
+void operator delete[](void * p) noexcept { std::free(p); }
+void operator delete(void * p, size_t) noexcept { std::free(p); }
+void operator delete[](void * p, size_t) noexcept { std::free(p); }
+
+#endif
@@ -0,0 +1,375 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+//##############################################################################
+// Benchmark of the RangeAPI_v1 read and write calls against a synthetic
+// BerkeleyDB environment; reads are run at the current graph version and at
+// the version the synthetic graph was built at (before the write benchmarks
+// moved it on). Prints JSON: p50/p99 latency, throughput and allocations per
+// op for every call. Run with `make bench`, or see --help for the graph size.
+//##############################################################################
+#include <sys/types.h>
+#include <dirent.h>
+#include <getopt.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+
+#include "../core/log.h"
+#include "../core/config.h"
+#include "../core/api.h"
+#include "../core/config_builder.h"
+#include "../db/berkeley_dbcxx_backend.h"
+#include "../db/pbuff_node.h"
+#include "../graph/node_factory.h"
+#include "../graph/graphdb.h"
+
+#include "bench_alloc.h"
+
+//##############################################################################
+//##############################################################################
+struct synthetic_graph {
+    size_t environments = 2;
+    size_t clusters = 8;                                                        ///< top-level clusters per environment
+    size_t depth = 3;                                                           ///< clusters in each chain, top-level included
+    size_t hosts = 10;                                                          ///< hosts in the innermost cluster of each chain
+    size_t tags = 2;                                                            ///< keys set on every cluster and host
+
+    //##########################################################################
+    static std::string env(size_t e) {
+        return "env" + std::to_string(static_cast<unsigned long long>(e));
+    }
+
+    //##########################################################################
+    static std::string cluster(size_t c, size_t d = 0) {
+        std::string name { "cluster" + std::to_string(static_cast<unsigned long long>(c)) };
+        return d ? name + "_" + std::to_string(static_cast<unsigned long long>(d)) : name;
+    }
+
+    //##########################################################################
+    static std::string host(size_t e, size_t c, size_t h) {
+        return "host" + std::to_string(static_cast<unsigned long long>(e)) + "-"
+            + std::to_string(static_cast<unsigned long long>(c)) + "-"
+            + std::to_string(static_cast<unsigned long long>(h)) + ".example.com";
+    }
+
+    //##########################################################################
+    static std::string key(size_t t) {
+        return "key" + std::to_string(static_cast<unsigned long long>(t));
+    }
+
+    //##########################################################################
+    std::string leaf(size_t c) const {
+        return cluster(c, depth - 1);
+    }
+
+    //##########################################################################
+    void tag(range::RangeAPI_v1 &api, const std::string &env_name, const std::string &node) const {
+        for (size_t t = 0; t < tags; ++t) {
+            api.add_node_key_value(env_name, node, key(t), "value" + std::to_string(static_cast<unsigned long long>(t)));
+        }
+    }
+
+    //##########################################################################
+    void build(range::RangeAPI_v1 &api) const {
+        for (size_t e = 0; e < environments; ++e) {
+            std::string env_name = env(e);
+            api.create_env(env_name);
+            for (size_t c = 0; c < clusters; ++c) {
+                api.add_cluster_to_env(env_name, cluster(c));
+                tag(api, env_name, cluster(c));
+                for (size_t d = 1; d < depth; ++d) {
+                    api.add_cluster_to_env(env_name, cluster(c, d));
+                    api.add_cluster_to_cluster(env_name, cluster(c, d - 1), cluster(c, d));
+                    tag(api, env_name, cluster(c, d));
+                }
+                for (size_t h = 0; h < hosts; ++h) {
+                    api.add_host(host(e, c, h));
+                    api.add_host_to_cluster(env_name, leaf(c), host(e, c, h));
+                    tag(api, env_name, host(e, c, h));
+                }
+                if (c > 0) {
+                    api.add_node_env_dependency(env_name, cluster(c), cluster(c - 1));
+                }
+            }
+        }
+    }
+};
+
+//##############################################################################
+//##############################################################################
+class BenchRecorder {
+    public:
+        //######################################################################
+        template <typename Fn>
+        void time(const std::string &name, Fn fn) {
+            auto it = results_.find(name);
+            if (it == results_.end()) {
+                order_.push_back(name);
+                it = results_.insert(std::make_pair(name, result())).first;
+            }
+            result &r = it->second;
+            if (r.latencies.size() == r.latencies.capacity()) {                 // keep our own growth out of the count
+                r.latencies.reserve(r.latencies.capacity() * 2 + 64);
+            }
+
+            uint64_t s_bytes = alloc_bytes.load();
+            uint64_t s_count = alloc_count.load();
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            auto end = std::chrono::steady_clock::now();
+            r.bytes += alloc_bytes.load() - s_bytes;
+            r.allocs += alloc_count.load() - s_count;
+            r.latencies.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+        }
+
+        //######################################################################
+        void json(std::ostream &out, const synthetic_graph &g, size_t iterations) {
+            out << "{\n  \"graph\": { \"environments\": " << g.environments
+                << ", \"clusters\": " << g.clusters << ", \"depth\": " << g.depth
+                << ", \"hosts\": " << g.hosts << ", \"tags\": " << g.tags
+                << ", \"iterations\": " << iterations << " },\n  \"results\": [";
+            for (size_t i = 0; i < order_.size(); ++i) {
+                result &r = results_[order_[i]];
+                std::vector<double> &l = r.latencies;
+                std::sort(l.begin(), l.end());
+                double total = 0;
+                for (double v : l) { total += v; }
+                double ops = static_cast<double>(l.size());
+
+                out << (i ? ",\n" : "\n") << "    { \"name\": \"" << order_[i] << "\""
+                    << ", \"ops\": " << l.size()
+                    << ", \"p50_us\": " << percentile(l, 50)
+                    << ", \"p99_us\": " << percentile(l, 99)
+                    << ", \"ops_per_sec\": " << (total > 0 ? ops * 1e6 / total : 0)
+                    << ", \"allocs_per_op\": " << r.allocs / ops
+                    << ", \"bytes_per_op\": " << r.bytes / ops << " }";
+            }
+            out << "\n  ]\n}" << std::endl;
+        }
+
+    private:
+        //######################################################################
+        struct result {
+            std::vector<double> latencies;                                      ///< microseconds
+            uint64_t bytes = 0;
+            uint64_t allocs = 0;
+        };
+
+        //######################################################################
+        static double percentile(const std::vector<double> &sorted, size_t pct) {
+            if (sorted.empty()) {
+                return 0;
+            }
+            size_t i = std::min(sorted.size() - 1, sorted.size() * pct / 100);
+            return sorted[i];
+        }
+
+        std::vector<std::string> order_;
+        std::map<std::string, result> results_;
+};
+
+//##############################################################################
+//##############################################################################
+static void
+bench_reads(range::RangeAPI_v1 &api, BenchRecorder &rec, const synthetic_graph &g,
+        size_t iterations, uint64_t version, const std::string &label)
+{
+    std::string env_name = g.env(0);
+    for (size_t i = 0; i < iterations; ++i) {
+        size_t c = i % g.clusters;
+        std::string top = g.cluster(c);
+        std::string host = g.host(0, c, i % g.hosts);
+
+        rec.time("expand_range_expression@" + label, [&]() { api.expand_range_expression(env_name, "%" + top, version); });
+        rec.time("expand@" + label, [&]() { api.expand(env_name, top, version); });
+        rec.time("simple_expand@" + label, [&]() { api.simple_expand(env_name, g.leaf(c), version); });
+        if (g.tags) {
+            rec.time("fetch_key@" + label, [&]() { api.fetch_key(env_name, host, g.key(0), version); });
+        }
+        rec.time("nearest_common_ancestor@" + label, [&]() {
+            api.nearest_common_ancestor(env_name, host, g.host(0, c, g.hosts - 1), version);
+        });
+    }
+
+    for (size_t i = 0; i < std::max<size_t>(iterations / 10, 1); ++i) {        // whole-graph calls
+        rec.time("all_hosts@" + label, [&]() { api.all_hosts(version); });
+        rec.time("environment_topological_sort@" + label, [&]() { api.environment_topological_sort(env_name, version); });
+    }
+}
+
+//##############################################################################
+//##############################################################################
+static void
+bench_writes(range::RangeAPI_v1 &api, BenchRecorder &rec, const synthetic_graph &g, size_t iterations)
+{
+    std::string env_name = g.env(0);
+    std::string leaf = g.leaf(0);
+    for (size_t i = 0; i < iterations; ++i) {
+        std::string n = std::to_string(static_cast<unsigned long long>(i));
+        std::string host = "bench-host" + n + ".example.com";
+        std::string benv = "bench_env" + n;
+
+        rec.time("add_host", [&]() { api.add_host(host); });
+        rec.time("add_host_to_cluster", [&]() { api.add_host_to_cluster(env_name, leaf, host); });
+        rec.time("add_node_key_value", [&]() { api.add_node_key_value(env_name, host, "bench", "v1"); });
+        api.add_node_key_value(env_name, host, "bench", "v2");
+        rec.time("remove_node_key_value", [&]() { api.remove_node_key_value(env_name, host, "bench", "v1"); });
+        rec.time("remove_key_from_node", [&]() { api.remove_key_from_node(env_name, host, "bench"); });
+        rec.time("remove_host_from_cluster", [&]() { api.remove_host_from_cluster(env_name, leaf, host); });
+        api.add_host_to_cluster(env_name, leaf, host);
+        rec.time("remove_host", [&]() { api.remove_host(env_name, host); });
+
+        if (g.clusters > 1) {
+            std::string last = g.cluster(g.clusters - 1);
+            rec.time("add_node_env_dependency", [&]() { api.add_node_env_dependency(env_name, last, g.cluster(0)); });
+            rec.time("remove_node_env_dependency", [&]() { api.remove_node_env_dependency(env_name, last, g.cluster(0)); });
+        }
+
+        rec.time("create_env", [&]() { api.create_env(benv); });
+        rec.time("add_cluster_to_env", [&]() { api.add_cluster_to_env(benv, "parent"); });
+        api.add_cluster_to_env(benv, "child");
+        rec.time("add_cluster_to_cluster", [&]() { api.add_cluster_to_cluster(benv, "parent", "child"); });
+        rec.time("remove_cluster_from_cluster", [&]() { api.remove_cluster_from_cluster(benv, "parent", "child"); });
+        rec.time("remove_cluster_from_env", [&]() { api.remove_cluster_from_env(benv, "child"); });
+        rec.time("remove_cluster", [&]() { api.remove_cluster(benv, "parent"); });
+        rec.time("remove_env", [&]() { api.remove_env(benv); });
+    }
+}
+
+//##############################################################################
+//##############################################################################
+static void
+print_help(const char * progname)
+{
+    std::cout << progname << ":" << std::endl
+        << "-e N, --environments=N\tenvironments to generate (2)" << std::endl
+        << "-c N, --clusters=N\ttop-level clusters per environment (8)" << std::endl
+        << "-d N, --depth=N\t\tclusters in each chain, top-level included (3)" << std::endl
+        << "-n N, --hosts=N\t\thosts in the innermost cluster of each chain (10)" << std::endl
+        << "-t N, --tags=N\t\tkeys set on every cluster and host (2)" << std::endl
+        << "-i N, --iterations=N\ttimes each call is made (100)" << std::endl
+        << "-o FILE, --output=FILE\twrite JSON to FILE rather than stdout" << std::endl
+        << "-h, --help\t\tprint this help message and exit" << std::endl;
+}
+
+const struct option longopts[] = {
+    { "environments",   required_argument,  NULL,   'e' },
+    { "clusters",       required_argument,  NULL,   'c' },
+    { "depth",          required_argument,  NULL,   'd' },
+    { "hosts",          required_argument,  NULL,   'n' },
+    { "tags",           required_argument,  NULL,   't' },
+    { "iterations",     required_argument,  NULL,   'i' },
+    { "output",         required_argument,  NULL,   'o' },
+    { "help",           no_argument,        NULL,   'h' },
+    { 0, 0, 0 ,0 }
+};
+
+const char optstring[] = "e:c:d:n:t:i:o:h";
+
+//##############################################################################
+//##############################################################################
+int
+main(int argc, char **argv)
+{
+    using namespace ::range;
+    synthetic_graph g;
+    size_t iterations = 100;
+    std::string output;
+
+    int lidx;
+    int c = 0;
+    while ( (c = getopt_long(argc, argv, optstring, longopts, &lidx)) > 0 ) {
+        switch(c) {
+            case 'e': g.environments = std::atoi(optarg); break;
+            case 'c': g.clusters = std::atoi(optarg); break;
+            case 'd': g.depth = std::atoi(optarg); break;
+            case 'n': g.hosts = std::atoi(optarg); break;
+            case 't': g.tags = std::atoi(optarg); break;
+            case 'i': iterations = std::atoi(optarg); break;
+            case 'o': output = optarg; break;
+            case 'h':
+                print_help(argv[0]);
+                return 0;
+            default:
+                print_help(argv[0]);
+                return 1;
+        }
+    }
+    if (!g.environments || !g.clusters || !g.depth || !g.hosts) {
+        std::cerr << "environments, clusters, depth and hosts must be at least 1" << std::endl;
+        return 1;
+    }
+
+    char p[] = "/tmp/db_bench_env.XXXXXXXXXX";
+    if(!mkdtemp(p)) {
+        std::cerr << "unable to create " << p << std::endl;
+        return 1;
+    }
+    std::string path { p };
+    ::range::initialize_logger("/dev/null", 0);
+
+    {
+        auto cfg = boost::make_shared<Config>();
+        auto db_conf = boost::make_shared<db::ConfigIface>(path, 67108864);
+        cfg->db_backend(db::BerkeleyDB::get(db_conf));
+        cfg->graph_factory(boost::make_shared<graph::GraphdbConcreteFactory<graph::GraphDB>>());
+        cfg->node_factory(boost::make_shared<graph::NodeIfaceConcreteFactory<db::ProtobufNode>>());
+        cfg->range_symbol_table(build_symtable());
+        cfg->use_stored(false);
+        cfg->stored_request_timeout(0);
+        cfg->reader_ack_timeout(0);
+        cfg->db_backend()->createGraphInstance("primary");
+        cfg->db_backend()->createGraphInstance("dependency");
+
+        RangeAPI_v1 api { cfg };
+        g.build(api);
+        uint64_t built = cfg->db_backend()->range_version();                    // the read API takes range versions
+
+        BenchRecorder rec;
+        bench_writes(api, rec, g, iterations);
+        bench_reads(api, rec, g, iterations, static_cast<uint64_t>(-1), "current");
+        bench_reads(api, rec, g, iterations, built, "historical");
+
+        if (output.empty()) {
+            rec.json(std::cout, g, iterations);
+        }
+        else {
+            std::ofstream out { output };
+            rec.json(out, g, iterations);
+        }
+    }
+    db::BerkeleyDB::backend_shutdown();
+
+    DIR* d = opendir(path.c_str());
+    struct dirent * dentry;
+    while( (dentry = readdir(d)) ) {
+        std::string f { path + '/' + dentry->d_name };
+        unlink(f.c_str());
+    }
+    closedir(d);
+    rmdir(path.c_str());
+    return 0;
+}
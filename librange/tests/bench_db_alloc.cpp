@@ -0,0 +1,144 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+//##############################################################################
+// Microbenchmark: heap bytes and allocations per read on the BerkeleyDB read
+// path (see bench_alloc.h for what is counted). Run with `make bench`.
+//##############################################################################
+#include <sys/types.h>
+#include <dirent.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+#include <boost/make_shared.hpp>
+
+#include "../core/log.h"
+#include "../db/config_interface.h"
+#include "../db/berkeley_dbcxx_backend.h"
+#include "../db/node_info_cache.h"
+#include "../db/pbuff_node.h"
+#include "../graph/graphdb.h"
+#include "../graph/node_factory.h"
+
+#include "bench_alloc.h"
+
+//##############################################################################
+//##############################################################################
+struct sample {
+    double bytes_per_op;
+    double allocs_per_op;
+};
+
+//##############################################################################
+//##############################################################################
+template <typename Fn>
+static sample
+measure(const std::vector<std::string> &names, size_t rounds, Fn fn)
+{
+    for (auto &name : names) { fn(name); }                                      // warm up; thread-local buffers grow here
+
+    uint64_t s_bytes = alloc_bytes.load();
+    uint64_t s_count = alloc_count.load();
+    for (size_t r = 0; r < rounds; ++r) {
+        for (auto &name : names) { fn(name); }
+    }
+    double ops = static_cast<double>(names.size() * rounds);
+    return sample { (alloc_bytes.load() - s_bytes) / ops, (alloc_count.load() - s_count) / ops };
+}
+
+//##############################################################################
+//##############################################################################
+static void
+report(const std::string &what, const sample &s)
+{
+    std::cout << std::left << std::setw(40) << what
+        << std::right << std::setw(14) << std::fixed << std::setprecision(1) << s.bytes_per_op
+        << std::setw(14) << s.allocs_per_op << std::endl;
+}
+
+//##############################################################################
+//##############################################################################
+int
+main(int argc, char **argv)
+{
+    using namespace ::range;
+    size_t n_nodes = (argc > 1) ? std::atoi(argv[1]) : 1000;
+    size_t rounds = (argc > 2) ? std::atoi(argv[2]) : 10;
+
+    char p[] = "/tmp/db_bench_env.XXXXXXXXXX";
+    if(!mkdtemp(p)) {
+        std::cerr << "unable to create " << p << std::endl;
+        return 1;
+    }
+    std::string path { p };
+
+    std::vector<std::string> names;
+    {
+        auto db_conf = boost::make_shared<db::ConfigIface>(path, 67108864);
+        auto backend = db::BerkeleyDB::get(db_conf);
+        auto inst = backend->createGraphInstance("bench");
+        auto graph = boost::make_shared<graph::GraphDB>("bench", inst,
+                boost::make_shared<graph::NodeIfaceConcreteFactory<db::ProtobufNode>>());
+
+        {
+            auto txn = graph->start_txn();
+            auto parent = graph->create("bench_cluster");
+            for (size_t i = 0; i < n_nodes; ++i) {
+                std::string name = "host" + std::to_string(static_cast<unsigned long long>(i)) + ".example.com";
+                auto n = graph->create(name);
+                n->update_tag("rack", { "r" + std::to_string(static_cast<unsigned long long>(i % 40)) });
+                parent->add_forward_edge(n);
+                names.push_back(name);
+            }
+        }
+
+        std::cout << std::left << std::setw(40) << "operation"
+            << std::right << std::setw(14) << "bytes/op" << std::setw(14) << "allocs/op" << std::endl;
+
+        report("get_record", measure(names, rounds, [&](const std::string &name) {
+            inst->get_record(db::GraphInstanceInterface::record_type::NODE, name);
+        }));
+
+        auto cache = db::NodeInfoCache::get();
+        size_t capacity = cache->capacity();
+
+        cache->set_capacity(0);
+        report("get_node (node cache disabled)", measure(names, rounds, [&](const std::string &name) {
+            graph->get_node(name)->forward_edges();
+        }));
+
+        cache->set_capacity(capacity);
+        report("get_node (node cache enabled)", measure(names, rounds, [&](const std::string &name) {
+            graph->get_node(name)->forward_edges();
+        }));
+    }
+    db::BerkeleyDB::backend_shutdown();
+
+    DIR* d = opendir(path.c_str());
+    struct dirent * dentry;
+    while( (dentry = readdir(d)) ) {
+        std::string f { path + '/' + dentry->d_name };
+        unlink(f.c_str());
+    }
+    closedir(d);
+    rmdir(path.c_str());
+    return 0;
+}
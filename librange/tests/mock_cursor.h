@@ -34,6 +34,8 @@ class MockCursor : public range::graph::GraphCursorInterface {
 
         MOCK_CONST_METHOD0(first, range::graph::GraphIterator::node_t(void));
         MOCK_CONST_METHOD0(last, range::graph::GraphIterator::node_t(void));
+        MOCK_CONST_METHOD0(ordered, bool(void));
+        MOCK_CONST_METHOD1(seek, range::graph::GraphIterator::node_t(const std::string& name));
 };
 
 #endif
@@ -27,6 +27,8 @@
 //##############################################################################
 class MockGraph : public range::graph::GraphInterface {
     public:
+        typedef std::map<range::graph::NodeIface::node_type, std::vector<std::string>> nodes_by_type_t;
+
         MOCK_CONST_METHOD0(V, size_t(void));
         MOCK_CONST_METHOD0(E, size_t(void));
         MOCK_CONST_METHOD0(version, uint64_t(void));
@@ -34,6 +36,8 @@ class MockGraph : public range::graph::GraphInterface {
         MOCK_CONST_METHOD1(forward_edges, std::vector<range::graph::GraphInterface::node_t>(const range::graph::NodeIface& node));
         MOCK_CONST_METHOD1(reverse_edges, std::vector<range::graph::GraphInterface::node_t>(const range::graph::NodeIface& node));
         MOCK_CONST_METHOD1(get_node, range::graph::GraphInterface::node_t(const std::string& name));
+        MOCK_CONST_METHOD1(find_nodes_by_prefix, std::vector<std::string>(const std::string& prefix));
+        MOCK_CONST_METHOD1(nodes_by_type, nodes_by_type_t(uint64_t version));
         MOCK_CONST_METHOD0(get_cursor, range::graph::GraphInterface::cursor_t(void));
         MOCK_CONST_METHOD1(get_cursor, range::graph::GraphInterface::cursor_t(range::graph::GraphIterator::node_t node));
         MOCK_CONST_METHOD0(cbegin, range::graph::GraphInterface::const_iterator_t(void));
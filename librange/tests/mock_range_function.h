@@ -30,5 +30,7 @@ class MockRangeFunction : public ::range::compiler::RangeFunction {
         virtual std::vector<std::string> operator()(const std::string &env_name, const std::vector<std::vector<std::string>>& vs) override {
             return call(env_name, vs);
         }
+        MOCK_METHOD3(with_name_prefix, std::vector<std::string>(const std::string &env_name,
+                    const std::vector<std::vector<std::string>>&, const std::string &name_prefix));
 };
 #endif
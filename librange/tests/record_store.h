@@ -0,0 +1,124 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _RANGE_TESTS_RECORD_STORE_H
+#define _RANGE_TESTS_RECORD_STORE_H
+
+#include <map>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <boost/make_shared.hpp>
+
+#include "../db/db_interface.h"
+#include "../db/pbuff_node.h"
+#include "../graph/graph_interface.h"
+#include "../util/crc32.h"
+
+#include "mock_transaction.h"
+#include "mock_instance.h"
+
+//##############################################################################
+/// Records held in memory, for what reads back what it wrote
+//##############################################################################
+class TestRecordStore : public ::testing::Test {
+    public:
+        virtual void SetUp() override
+        {
+            back_with_records(boost::make_shared<MockInstance>());
+        }
+
+        //######################################################################
+        /// Make instance the graph under test, keeping its records in records
+        void back_with_records(boost::shared_ptr<MockInstance> instance)
+        {
+            using namespace ::testing;
+            inst = instance;
+
+            EXPECT_CALL(*inst, version())
+                .Times(AtLeast(0))
+                .WillRepeatedly(Return(0));
+
+            EXPECT_CALL(*inst, start_txn())
+                .Times(AtLeast(0))
+                .WillRepeatedly(Return(boost::make_shared<MockTransaction>()));
+
+            EXPECT_CALL(*inst, get_record(_, _))
+                .Times(AnyNumber())
+                .WillRepeatedly(Invoke([this](range::db::GraphInstanceInterface::record_type type, const std::string &key) {
+                            return records[std::make_pair(type, key)];
+                        }));
+
+            EXPECT_CALL(*inst, write_record(_, _, _, _))
+                .Times(AnyNumber())
+                .WillRepeatedly(Invoke([this](range::db::GraphInstanceInterface::record_type type, const std::string &key,
+                                uint64_t, const std::string &data) {
+                            records[std::make_pair(type, key)] = data;
+                            return true;
+                        }));
+
+            EXPECT_CALL(*inst, remove_records(_, _))
+                .Times(AnyNumber())
+                .WillRepeatedly(Invoke([this](range::db::GraphInstanceInterface::record_type type, const std::string &prefix) {
+                            size_t removed = 0;
+                            auto it = records.lower_bound(std::make_pair(type, prefix));
+                            while (it != records.end() && it->first.first == type
+                                    && it->first.second.compare(0, prefix.size(), prefix) == 0) {
+                                removed += !it->second.empty();
+                                it = records.erase(it);
+                            }
+                            return removed;
+                        }));
+        }
+
+        boost::shared_ptr<MockInstance> inst;
+        std::map<std::pair<range::db::GraphInstanceInterface::record_type, std::string>, std::string> records;
+        static const auto rectype = range::db::GraphInstanceInterface::record_type::NODE;
+};
+
+//##############################################################################
+//##############################################################################
+inline range::db::NodeInfo
+make_sectioned_test_info()
+{
+    range::db::NodeInfo info;
+    info.set_list_version(2);
+    info.set_format_version(range::db::ProtobufNode::format_version);
+    info.set_node_type(static_cast<int>(range::graph::NodeIface::node_type::CLUSTER));
+    auto kv = info.mutable_tags()->add_keys();
+    kv->set_key("ROLE");
+    kv->set_key_version(1);
+    kv->add_versions(2);
+    auto vmap = kv->add_versionmap();
+    vmap->set_list_version(2);
+    vmap->set_key_version(1);
+    auto val = kv->add_values();
+    val->set_data("kafka");
+    val->add_versions(1);
+    auto edge = info.mutable_forward()->add_edges();
+    edge->set_id("child");
+    edge->add_versions(2);
+    info.mutable_reverse();
+    info.add_live()->set_first(0);
+    info.set_crc32(0);
+    info.set_crc32(range::util::crc32(info.SerializeAsString()));
+    return info;
+}
+
+#endif
@@ -707,6 +707,51 @@ TEST_F(TestCompiler, test_key_expand)
     ASSERT_THAT(children, ElementsAre("world1", "world2"));
 }
 
+//##############################################################################
+//##############################################################################
+TEST_F(TestCompiler, test_regex_literal_prefix)
+{
+    EXPECT_EQ("web1", c::regex_literal_prefix("^web1"));
+    EXPECT_EQ("web", c::regex_literal_prefix("^web1*"));
+    EXPECT_EQ("web", c::regex_literal_prefix("^web\\d+"));
+    EXPECT_EQ("web", c::regex_literal_prefix("^web\\."));
+    EXPECT_EQ("", c::regex_literal_prefix("web1"));
+    EXPECT_EQ("", c::regex_literal_prefix("^web|^db"));
+    EXPECT_EQ("", c::regex_literal_prefix("^[wd]"));
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestCompiler, test_function_regex_pushdown)
+{
+    auto func = boost::make_shared<MockRangeFunction>();
+
+    EXPECT_CALL(*func, call(_, _))
+        .Times(0);
+    EXPECT_CALL(*func, with_name_prefix("", std::vector<std::vector<std::string>>(
+                    {
+                        {"thing0", "thing1", "thing2", "thing3", "thing4", "thing5", "thing6"}
+                    }
+                ), "thing1"))
+        .Times(1)
+        .WillOnce(Return(std::vector<std::string>({"thing1", "thing10"})));
+
+    auto symtable = boost::make_shared<::range::compiler::functor_map_t>();
+    (*symtable)["test_function"] = func;
+    auto sc = ::rangecompiler::make_string_scanner_v1("test_function(%testcluster1) & /^thing1$/", symtable);
+
+    ::rangecompiler::RangeParser_v1 parser { sc };
+    int success = parser.parse();
+    ASSERT_EQ(0, success);
+
+    auto top = parser.ast();
+
+    boost::apply_visitor(c::RangeExpandingVisitor(graph_), top);
+    auto children = boost::apply_visitor(c::FetchChildrenVisitor(), top);
+
+    ASSERT_THAT(children, ElementsAre("thing1"));
+}
+
 
 
 
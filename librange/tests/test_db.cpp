@@ -40,6 +40,10 @@
 #include "../db/berkeley_dbcxx_txn.h"
 #include "../db/berkeley_dbcxx_lock.h"
 #include "../db/berkeley_dbcxx_cursor.h"
+#include "../db/berkeley_dbcxx_group_commit.h"
+#include "../db/node_info_cache.h"
+#include "../db/pbuff_node.h"
+#include "../util/crc32.h"
 
 using namespace ::testing;
 
@@ -200,6 +204,21 @@ TEST_F(TestGraphDB, test_readlock_before_writelock) {
     ASSERT_FALSE(lock->readonly());
 }
 
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_lock_classes) {
+    {
+        auto lock = instance->read_lock(range::db::GraphInstanceInterface::record_type::NODE, "foobar");
+        EXPECT_NE(nullptr, boost::dynamic_pointer_cast<range::db::BerkeleyDBCXXReadLock>(lock));
+        EXPECT_TRUE(lock->readonly());
+    }
+    {
+        auto lock = instance->write_lock(range::db::GraphInstanceInterface::record_type::NODE, "foobar");
+        EXPECT_NE(nullptr, boost::dynamic_pointer_cast<range::db::BerkeleyDBCXXWriteLock>(lock));
+        EXPECT_FALSE(lock->readonly());
+    }
+}
+
 //##############################################################################
 //##############################################################################
 TEST_F(TestGraphDB, test_db_readwrite) {
@@ -374,6 +393,299 @@ TEST_F(TestGraphDB, test_multiple_db_txn) {
     }
 }
 
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_version_record) {
+    range::db::ChangeList legacy;                                               // a graph from before the changelist was split
+    legacy.set_current_version(2);
+    for (int v = 1; v <= 2; ++v) {
+        auto change = legacy.add_change();
+        change->mutable_timestamp()->set_seconds(v);
+        change->mutable_timestamp()->set_msec(0);
+        auto item = change->add_items();
+        item->set_key(range::db::BerkeleyDBCXXDb::key_name(range::db::GraphInstanceInterface::record_type::NODE, "foobar"));
+        item->set_version(v);
+    }
+    {
+        auto lock = instance->write_lock(range::db::GraphInstanceInterface::record_type::GRAPH_META, "changelist");
+        instance->write_record(range::db::GraphInstanceInterface::record_type::GRAPH_META, "changelist", 0, legacy.SerializeAsString());
+    }
+    EXPECT_EQ(2, instance->version());
+    EXPECT_EQ(2, instance->get_change_history().size());
+    EXPECT_EQ("", instance->get_record(range::db::GraphInstanceInterface::record_type::GRAPH_META, "version"));
+
+    {
+        auto lock = instance->write_lock(range::db::GraphInstanceInterface::record_type::NODE, "foobar");
+        instance->write_record(range::db::GraphInstanceInterface::record_type::NODE, "foobar", 3, "I like Cheese!");
+    }
+    EXPECT_EQ(3, instance->version());
+    EXPECT_EQ("3", instance->get_record(range::db::GraphInstanceInterface::record_type::GRAPH_META, "version"));
+
+    auto history = instance->get_change_history();
+    ASSERT_EQ(3, history.size());
+    uint64_t v = 1;
+    for (auto &clist : history) {
+        ASSERT_EQ(1, clist.size());
+        EXPECT_EQ("foobar", std::get<1>(clist[0]));
+        EXPECT_EQ(v++, std::get<2>(clist[0]));
+    }
+
+    range::db::ChangeList migrated;
+    migrated.ParseFromString(instance->get_record(range::db::GraphInstanceInterface::record_type::GRAPH_META, "changelist"));
+    EXPECT_EQ(2, migrated.current_version());
+    EXPECT_EQ(0, migrated.change_size());
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_range_version_at) {
+    std::time_t before = std::time(nullptr) - 1;
+    EXPECT_EQ(static_cast<uint64_t>(-1), backendp->range_version_at(before));
+
+    for (int i = 0; i < 3; ++i) {
+        backendp->add_new_range_version();
+    }
+    std::time_t after = std::time(nullptr) + 1;
+
+    EXPECT_EQ(3, backendp->range_version());
+    EXPECT_EQ(3, backendp->range_version_at(after));
+    EXPECT_EQ(static_cast<uint64_t>(-1), backendp->range_version_at(before));
+    EXPECT_EQ(backendp->BackendInterface::range_version_at(after), backendp->range_version_at(after));
+    EXPECT_EQ(backendp->BackendInterface::range_version_at(before), backendp->range_version_at(before));
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_node_version_at) {
+    std::vector<std::tuple<std::string, uint64_t>> writes {
+        std::make_tuple("foobar", 5), std::make_tuple("foobar", 6), std::make_tuple("other", 1)
+    };
+    for (auto &w : writes) {
+        auto lock = instance->write_lock(range::db::GraphInstanceInterface::record_type::NODE, std::get<0>(w));
+        instance->write_record(range::db::GraphInstanceInterface::record_type::NODE, std::get<0>(w), std::get<1>(w), "I like Cheese!");
+    }
+    ASSERT_EQ(3, instance->version());
+
+    EXPECT_EQ(5, instance->node_version_at("foobar", 1));
+    EXPECT_EQ(6, instance->node_version_at("foobar", 2));
+    EXPECT_EQ(6, instance->node_version_at("foobar", 3));
+    EXPECT_EQ(static_cast<uint64_t>(-1), instance->node_version_at("other", 2));
+    EXPECT_EQ(1, instance->node_version_at("other", 3));
+    EXPECT_EQ(static_cast<uint64_t>(-1), instance->node_version_at("nonexistent", 3));
+
+    for (uint64_t v = 1; v <= 3; ++v) {
+        EXPECT_EQ(instance->GraphInstanceInterface::node_version_at("foobar", v), instance->node_version_at("foobar", v));
+    }
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_deltas) {
+    typedef range::db::BackendInterface::graph_delta_t graph_delta_t;
+    std::vector<graph_delta_t> seen;
+    auto sub = backendp->subscribe_deltas("primary", 0,
+            [&seen](const graph_delta_t &delta) { seen.push_back(delta); });
+    EXPECT_TRUE(backendp->catch_up_deltas("primary"));
+    EXPECT_TRUE(seen.empty());
+
+    for (auto name : { "foobar", "other", "foobar" }) {
+        auto lock = instance->write_lock(range::db::GraphInstanceInterface::record_type::NODE, name);
+        instance->write_record(range::db::GraphInstanceInterface::record_type::NODE, name, 1, "I like Cheese!");
+    }
+    EXPECT_TRUE(backendp->catch_up_deltas("primary"));
+    ASSERT_EQ(3, seen.size());
+    EXPECT_EQ("primary", seen[1].graph);
+    EXPECT_EQ(2, seen[1].version);
+    EXPECT_THAT(seen[1].nodes, ElementsAre("other"));
+    EXPECT_THAT(seen[2].nodes, ElementsAre("foobar"));
+
+    EXPECT_TRUE(backendp->catch_up_deltas("primary"));                          // nothing new
+    EXPECT_EQ(3, seen.size());
+
+    std::vector<uint64_t> late;
+    auto late_sub = backendp->subscribe_deltas("primary", 2,
+            [&late](const graph_delta_t &delta) { late.push_back(delta.version); });
+    sub.reset();
+    {
+        auto lock = instance->write_lock(range::db::GraphInstanceInterface::record_type::NODE, "other");
+        instance->write_record(range::db::GraphInstanceInterface::record_type::NODE, "other", 2, "I like Cheese!");
+    }
+    EXPECT_TRUE(backendp->catch_up_deltas("primary"));
+    EXPECT_EQ(3, seen.size());                                                  // unsubscribed
+    EXPECT_THAT(late, ElementsAre(3, 4));
+
+    range::db::GraphInstanceInterface::changelist_t change, walked;
+    ASSERT_TRUE(instance->get_change(4, change));
+    ASSERT_TRUE(instance->GraphInstanceInterface::get_change(4, walked));
+    EXPECT_EQ(walked, change);
+    EXPECT_FALSE(instance->get_change(5, change));
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_read_snapshot) {
+    typedef range::db::GraphInstanceInterface::record_type record_type;
+    {
+        auto lock = instance->write_lock(record_type::NODE, "foobar");
+        instance->write_record(record_type::NODE, "foobar", 1, "before");
+    }
+
+    {
+        auto snapshot = backendp->read_snapshot();
+        ASSERT_NE(nullptr, snapshot);
+        auto lock = instance->read_lock(record_type::NODE, "foobar");
+        EXPECT_EQ(lock, instance->read_lock(record_type::NODE, "foobar"));         // every read shares the snapshot's txn
+        EXPECT_EQ("before", instance->get_record(record_type::NODE, "foobar"));
+
+        std::thread writer([this]() {
+            backendp->register_thread();
+            auto lock = instance->write_lock(record_type::NODE, "foobar");
+            instance->write_record(record_type::NODE, "foobar", 2, "after");
+        });
+        writer.join();
+
+        EXPECT_EQ("before", instance->get_record(record_type::NODE, "foobar"));
+        EXPECT_EQ(1, instance->version());
+    }
+
+    EXPECT_EQ("after", instance->get_record(record_type::NODE, "foobar"));
+    EXPECT_EQ(2, instance->version());
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_node_cache_sees_other_env_handle) {
+    typedef range::db::GraphInstanceInterface::record_type record_type;
+    auto record = [](uint64_t list_version) {
+        range::db::NodeInfo info;
+        info.set_list_version(list_version);
+        info.set_node_type(static_cast<int>(range::graph::NodeIface::node_type::HOST));
+        info.mutable_tags();
+        info.mutable_forward();
+        info.mutable_reverse();
+        info.set_crc32(0);
+        info.set_crc32(range::util::crc32(info.SerializeAsString()));
+        return range::db::NodeRecord::encode(info, range::db::NodeRecord::node_encoding::PROTOBUF);
+    };
+    {
+        auto lock = instance->write_lock(record_type::NODE, "foobar");
+        instance->write_record(record_type::NODE, "foobar", 1, record(1));
+    }
+
+    auto cache = range::db::NodeInfoCache::get();
+    for (int i = 0; i < 2; ++i) {
+        auto snapshot = backendp->read_snapshot();
+        EXPECT_EQ(1, range::db::ProtobufNode("foobar", instance).version());
+    }
+    uint64_t hits = cache->hits();
+    ASSERT_LT(0, hits);
+
+    {                                                                           // as another process would: its own
+        DbEnv env { 0 };                                                        // environment handle, and nothing
+        env.open(path.c_str(), DB_INIT_LOCK | DB_INIT_LOG | DB_INIT_MPOOL     // this process is told of
+                | DB_INIT_TXN | DB_THREAD, 0);
+        Db db { &env, 0 };
+        DbTxn * txn;
+        env.txn_begin(NULL, &txn, 0);
+        db.open(txn, "primary", "primary", DB_UNKNOWN, DB_THREAD, 0);
+        auto inst = boost::dynamic_pointer_cast<range::db::BerkeleyDBCXXDb>(instance);
+        for (auto &kv : { std::make_pair(inst->db_key(record_type::NODE, "foobar"), record(2)),
+                std::make_pair(inst->db_key(record_type::GRAPH_META, "version"), std::string("2")) }) {
+            Dbt key { (void*) kv.first.c_str(), (uint32_t) kv.first.size() };
+            Dbt data { (void*) kv.second.c_str(), (uint32_t) kv.second.size() };
+            ASSERT_EQ(0, db.put(txn, &key, &data, 0));
+        }
+        txn->commit(0);
+        db.close(0);
+        env.close(0);
+    }
+
+    auto snapshot = backendp->read_snapshot();
+    EXPECT_EQ(2, instance->version());
+    EXPECT_EQ(2, range::db::ProtobufNode("foobar", instance).version());
+    EXPECT_EQ(hits, cache->hits());
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_write_batch) {
+    typedef range::db::GraphInstanceInterface::record_type record_type;
+    backendp->begin_write_batch();
+    backendp->begin_write_batch();                                              // batches nest
+    {
+        auto lock = instance->write_lock(record_type::NODE, "foo");
+        instance->write_record(record_type::NODE, "foo", 1, "foo");
+    }
+    backendp->end_write_batch();
+    {
+        auto lock = instance->write_lock(record_type::NODE, "bar");
+        instance->write_record(record_type::NODE, "bar", 1, "bar");
+    }
+    backendp->end_write_batch();
+    EXPECT_EQ(2, instance->version());
+
+    std::vector<std::thread> writers;
+    for (int i = 0; i < 8; ++i) {
+        writers.push_back(std::thread([this, i]() {
+            backendp->register_thread();
+            std::string key = "writer" + std::to_string(static_cast<long long>(i));
+            backendp->begin_write_batch();
+            {
+                auto lock = instance->write_lock(record_type::NODE, key);
+                instance->write_record(record_type::NODE, key, 1, key);
+            }
+            backendp->end_write_batch();
+        }));
+    }
+    for (auto &t : writers) {
+        t.join();
+    }
+
+    EXPECT_EQ(10, instance->version());
+    EXPECT_EQ("foo", instance->get_record(record_type::NODE, "foo"));
+    EXPECT_EQ("bar", instance->get_record(record_type::NODE, "bar"));
+    for (int i = 0; i < 8; ++i) {
+        std::string key = "writer" + std::to_string(static_cast<long long>(i));
+        EXPECT_EQ(key, instance->get_record(record_type::NODE, key));
+    }
+
+    DbEnv env { 0 };
+    env.open(path.c_str(), DB_INIT_LOCK | DB_INIT_LOG | DB_INIT_MPOOL
+            | DB_INIT_TXN | DB_THREAD, 0);
+    {
+        range::db::BerkeleyDBCXXGroupCommit sync { &env,
+            range::db::ConfigIface::durability::SYNC, std::chrono::microseconds(0) };
+        EXPECT_EQ(DB_TXN_SYNC, sync.commit_flags());
+        sync.begin_batch();
+        EXPECT_EQ(DB_TXN_NOSYNC, sync.commit_flags());
+        sync.committed();
+        sync.begin_batch();
+        sync.committed();
+        sync.end_batch();
+        EXPECT_EQ(0, sync.flushes());
+        sync.committed();
+        sync.end_batch();
+        EXPECT_EQ(1, sync.flushes());                                           // once, for all three commits
+        sync.begin_batch();
+        sync.end_batch();
+        EXPECT_EQ(1, sync.flushes());                                           // nothing committed, nothing flushed
+    }
+    {
+        range::db::BerkeleyDBCXXGroupCommit group { &env,
+            range::db::ConfigIface::durability::GROUP_COMMIT, std::chrono::milliseconds(200) };
+        std::vector<std::thread> committers;
+        for (int i = 0; i < 8; ++i) {
+            committers.push_back(std::thread([&group]() { group.committed(); }));
+        }
+        for (auto &t : committers) {
+            t.join();
+        }
+        EXPECT_LE(1, group.flushes());
+        EXPECT_GT(4, group.flushes());                                          // the leader's delay gathers the rest
+    }
+    env.close(0);
+}
+
 //##############################################################################
 //##############################################################################
 TEST_F(TestGraphDB, test_n_vertices) {
@@ -410,6 +722,80 @@ TEST_F(TestGraphDB, test_n_redges) {
 
 
 
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_btree_layout) {
+    typedef range::db::GraphInstanceInterface::record_type record_type;
+    auto btree_cfg = boost::make_shared<range::db::ConfigIface>(path, 67108864, 65536,
+            range::db::ConfigIface::durability::SYNC, std::chrono::microseconds(0),
+            range::db::ConfigIface::access_method::BTREE);
+    auto inst = range::db::BerkeleyDBCXXDb::get("ordered", backendp, btree_cfg);
+    ASSERT_TRUE(inst->ordered());
+    EXPECT_EQ(std::string("\0env1#a", 7), inst->db_key(record_type::NODE, "env1#a"));
+
+    {
+        auto lock = inst->write_lock(record_type::NODE, "");
+        auto txn = inst->start_txn();
+        for (auto name : { "env2#b", "env1#a", "env1#b" }) {
+            inst->write_record(record_type::NODE, name, 1, "0");
+        }
+        inst->write_record(record_type::GRAPH_META, "n_vertices", 0, "3");
+    }
+    EXPECT_EQ("3", inst->get_record(record_type::GRAPH_META, "n_vertices"));
+    EXPECT_EQ("0", inst->get_record(record_type::NODE, "env1#b"));
+
+    auto c = inst->get_cursor();
+    std::vector<std::string> names;
+    for (auto n = c->first(); n; n = c->next()) {
+        names.push_back(n->name());
+    }
+    ASSERT_THAT(names, ElementsAre("env1#a", "env1#b", "env2#b"));              // in key order, without the metadata
+    EXPECT_EQ("env2#b", c->last()->name());
+    EXPECT_EQ("env1#b", c->prev()->name());
+    EXPECT_EQ(nullptr, c->prev(c->first()));
+    c.reset();
+
+    for (auto name : { "env1#a", "env2#b" }) {                                  // versions 2 and 3
+        auto lock = inst->write_lock(record_type::NODE, name);
+        inst->write_record(record_type::NODE, name, 2, "1");
+    }
+    auto listed = inst->get_change_history();                                   // read in one pass over the change keys
+    std::vector<range::db::GraphInstanceInterface::changelist_t> history { listed.begin(), listed.end() };
+    ASSERT_EQ(3, history.size());
+    EXPECT_EQ(3, history[0].size());
+    ASSERT_EQ(1, history[1].size());
+    EXPECT_EQ("env1#a", std::get<1>(history[1][0]));
+    ASSERT_EQ(1, history[2].size());
+    EXPECT_EQ("env2#b", std::get<1>(history[2][0]));
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_convert_access_method) {
+    typedef range::db::GraphInstanceInterface::record_type record_type;
+    auto hash_cfg = boost::make_shared<range::db::ConfigIface>(path, 67108864);
+    {
+        auto inst = range::db::BerkeleyDBCXXDb::get("convertme", backendp, hash_cfg);
+        ASSERT_FALSE(inst->ordered());
+        auto lock = inst->write_lock(record_type::NODE, "");
+        inst->write_record(record_type::NODE, "env1#a", 1, "a");
+        inst->write_record(record_type::GRAPH_META, "n_vertices", 0, "1");
+    }
+    range::db::BerkeleyDBCXXDb::close_db("convertme");
+
+    auto env = range::db::BerkeleyDBCXXEnv::get(hash_cfg);
+    EXPECT_TRUE(range::db::BerkeleyDBCXXDb::convert("convertme", DB_BTREE, env));
+    EXPECT_FALSE(range::db::BerkeleyDBCXXDb::convert("convertme", DB_BTREE, env));
+    EXPECT_FALSE(range::db::BerkeleyDBCXXDb::convert("nonexistent", DB_BTREE, env));
+
+    auto inst = range::db::BerkeleyDBCXXDb::get("convertme", backendp,
+            hash_cfg);                                                          // the file's layout wins over the config's
+    ASSERT_TRUE(inst->ordered());
+    EXPECT_EQ("a", inst->get_record(record_type::NODE, "env1#a"));
+    EXPECT_EQ(1, inst->n_vertices());
+    EXPECT_EQ(1, inst->version());
+}
+
 //##############################################################################
 //##############################################################################
 // TestDBCursor
@@ -0,0 +1,65 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <google/protobuf/message.h>
+#include <boost/make_shared.hpp>
+
+#include "../core/log.h"
+#include "../db/pbuff_node.h"
+
+#include "record_store.h"
+
+using namespace ::testing;
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestRecordStore, TestNamesWithoutNodes) {
+    range::db::NodeInfo info = make_sectioned_test_info();
+    records[std::make_pair(rectype, "test1")] = info.SerializeAsString();
+
+    auto node = boost::make_shared<range::db::ProtobufNode>("test1", inst);
+    auto edges = node->forward_edge_range();
+    ASSERT_EQ(1, edges.size());
+    EXPECT_EQ("child", edges.begin()->name);
+    EXPECT_EQ(2, edges.begin()->version);
+    EXPECT_TRUE(node->reverse_edge_range().empty());
+
+    node.reset();                                                               // the range keeps what it refers to
+    EXPECT_EQ("child", edges.begin()->name);
+    auto child = edges.node(edges.begin());
+    EXPECT_EQ("child", child->name());
+    EXPECT_EQ(static_cast<uint64_t>(-1), child->get_wanted_version());          // as our node's
+
+    auto older = boost::make_shared<range::db::ProtobufNode>("test1", inst, 1);
+    EXPECT_TRUE(older->forward_edge_range().empty());
+}
+
+//##############################################################################
+//##############################################################################
+int
+main(int argc, char **argv)
+{
+    range::initialize_logger("/dev/null", 0);
+    GOOGLE_PROTOBUF_VERIFY_VERSION;
+    ::testing::InitGoogleTest(&argc, argv);
+    range::db::ProtobufNode::s_shutdown();
+    return RUN_ALL_TESTS();
+}
@@ -28,11 +28,18 @@
 #include "../graph/node_interface.h"
 #include "../graph/graph_interface.h"
 #include "../graph/node_factory.h"
+#include "../graph/id_adjacency.h"
+#include "../graph/csr_snapshot.h"
+#include "../graph/host_closure.h"
 #include "../db/pbuff_node.h"
+#include "../db/node_tag_index.h"
+#include "../db/node_type_index.h"
+#include "../util/crc32.h"
 
 using namespace ::testing;
 
 #include "mock_instance.h"
+#include "mock_backend.h"
 #include "mock_node.h"
 #include "mock_cursor.h"
 #include "mock_graph.h"
@@ -97,21 +104,11 @@ TEST_F(TestGraphDB, test_version) {
 TEST_F(TestGraphDB, test_wanted_version) {
     auto inst = boost::make_shared<MockInstance>();
     EXPECT_CALL(*inst, version())
-        .Times(3)
+        .Times(2)
         .WillRepeatedly(Return(99));
 
-    EXPECT_CALL(*inst, n_vertices())
-        .Times(1)
-        .WillRepeatedly(Return(10));
-
-    std::list<::range::db::GraphInstanceInterface::changelist_t> clist;
-    for(int i = 0; i < 99; ++i) {
-        clist.push_back(::range::db::GraphInstanceInterface::changelist_t());
-    }
-
-    EXPECT_CALL(*inst, get_change_history())
-        .Times(1)
-        .WillRepeatedly(Return(clist));
+    EXPECT_CALL(*inst, get_change_history())                                    // history is only read for nodes we look up
+        .Times(0);
 
 
     range::graph::GraphDB gdb { "primary", inst, range::graph::GraphDB::node_factory_t(new range::graph::NodeIfaceConcreteFactory<MockNode>()) };
@@ -517,11 +514,438 @@ TEST_F(TestGraphDB, test_remove) {
     //Mock::VerifyAndClearExpectations(thisnode.get());
 }
 
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_update_versions) {
+    auto inst = boost::make_shared<MockInstance>();
+    auto txn = boost::make_shared<MockTransaction>();
+    auto thisnode = boost::make_shared<MockNode>();
+    auto removed = boost::make_shared<MockNode>();
+
+    EXPECT_CALL(*txn, flush())
+        .Times(AtLeast(0));
+
+    EXPECT_CALL(*thisnode, name())
+        .Times(AtLeast(0))
+        .WillRepeatedly(Return("foobar"));
+
+    EXPECT_CALL(*thisnode, graph_versions())
+        .Times(1)
+        .WillOnce(Return(std::vector<uint64_t>({ 99, 100 })));
+
+    EXPECT_CALL(*thisnode, add_forward_edge(_, true))
+        .Times(1)
+        .WillOnce(Return(true));
+
+    EXPECT_CALL(*thisnode, forward_edges())
+        .Times(1)
+        .WillOnce(Return(std::vector<range::graph::NodeIface::node_t>()));
+
+    EXPECT_CALL(*thisnode, reverse_edges())
+        .Times(1)
+        .WillOnce(Return(std::vector<range::graph::NodeIface::node_t>()));
 
+    EXPECT_CALL(*removed, remove_graph_version(100))
+        .Times(1);
 
+    EXPECT_CALL(*removed, add_graph_version(_))
+        .Times(0);
 
+    EXPECT_CALL(*inst, version())
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(100));
 
+    EXPECT_CALL(*inst, get_record(range::db::GraphInstanceInterface::record_type::GRAPH_META, "live_intervals"))
+        .Times(1)
+        .WillOnce(Return("42"));
 
+    EXPECT_CALL(*inst, get_cursor())                                            // untouched nodes are never visited
+        .Times(0);
+
+    EXPECT_CALL(*inst, start_txn())
+        .Times(2)
+        .WillRepeatedly(Return(txn));
+
+    std::stack<boost::shared_ptr<MockNode>> nodestack { {removed} };
+    range::graph::GraphDB gdb { "primary", inst, range::graph::GraphDB::node_factory_t(new MockNodeFactory(nodestack)) };
+    gdb.remove(thisnode);
+    gdb.update_versions(99);
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_find_nodes_by_prefix) {
+    auto inst = boost::make_shared<MockInstance>();
+    EXPECT_CALL(*inst, version())
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(4));
+
+    std::vector<boost::shared_ptr<MockNode>> nodes;
+    std::vector<std::pair<std::string, std::vector<uint64_t>>> spec {
+        { "prod#a", { 1, 2, 3, 4 } },
+        { "prod#b", { 1, 2 } },                                                 // removed before version 4
+        { "prod#c", { 4 } },
+        { "prod$", { 4 } },                                                     // past the end of the prefix
+    };
+    for (auto &s : spec) {
+        auto node = boost::make_shared<MockNode>("", inst);
+        EXPECT_CALL(*node, name())
+            .Times(AtLeast(0))
+            .WillRepeatedly(Return(s.first));
+        EXPECT_CALL(*node, graph_versions())
+            .Times(AtLeast(0))
+            .WillRepeatedly(Return(s.second));
+        nodes.push_back(node);
+    }
+
+    auto cur = boost::make_shared<MockCursor>();
+    EXPECT_CALL(*cur, ordered())
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(true));
+    EXPECT_CALL(*cur, seek("prod#"))
+        .Times(1)
+        .WillOnce(Return(nodes[0]));
+    EXPECT_CALL(*cur, next())
+        .Times(3)
+        .WillOnce(Return(nodes[1]))
+        .WillOnce(Return(nodes[2]))
+        .WillOnce(Return(nodes[3]));
+    EXPECT_CALL(*cur, first())                                                  // no full scan on an ordered cursor
+        .Times(0);
+
+    EXPECT_CALL(*inst, get_cursor())
+        .Times(1)
+        .WillOnce(Return(cur));
+
+    range::graph::GraphDB gdb { "primary", inst, range::graph::GraphDB::node_factory_t(new range::graph::NodeIfaceConcreteFactory<MockNode>()) };
+
+    std::vector<std::string> expected { "prod#a", "prod#c" };
+    EXPECT_EQ(expected, gdb.find_nodes_by_prefix("prod#"));
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_prefix_end) {
+    EXPECT_EQ("prod$", range::graph::GraphCursorInterface::prefix_end("prod#"));
+    EXPECT_EQ("b", range::graph::GraphCursorInterface::prefix_end("a\xff\xff"));
+    EXPECT_EQ("", range::graph::GraphCursorInterface::prefix_end("\xff"));
+    EXPECT_EQ("", range::graph::GraphCursorInterface::prefix_end(""));
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_find_nodes_by_type) {
+    typedef range::db::GraphInstanceInterface::record_type record_type;
+    auto inst = boost::make_shared<MockInstance>();
+
+    range::db::TypeIndexShard shard;
+    shard.set_format_version(range::db::NodeTypeIndex::format_version);
+    auto entry = shard.add_entries();
+    entry->set_name("host1");
+    entry->add_live()->set_first(3);
+    std::string key = "type_index:" + std::to_string(static_cast<int>(range::graph::NodeIface::node_type::HOST))
+        + ":" + std::to_string(range::util::crc32("host1") % range::db::NodeTypeIndex::min_shards);
+
+    EXPECT_CALL(*inst, get_record(record_type::GRAPH_META, "type_index"))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return("3"));
+    EXPECT_CALL(*inst, get_record(record_type::NODE_META, _))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(""));
+    EXPECT_CALL(*inst, get_record(record_type::NODE_META, key))
+        .Times(1)
+        .WillOnce(Return(shard.SerializeAsString()));
+    EXPECT_CALL(*inst, get_cursor())                                            // indexed; no scan
+        .Times(0);
+
+    range::graph::GraphDB gdb { "primary", inst, range::graph::GraphDB::node_factory_t(new range::graph::NodeIfaceConcreteFactory<MockNode>()) };
+
+    EXPECT_THAT(gdb.find_nodes_by_type(range::graph::NodeIface::node_type::HOST, 4), ElementsAre("host1"));
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestGraphDB, test_find_nodes_by_tag) {
+    typedef range::db::GraphInstanceInterface::record_type record_type;
+    auto inst = boost::make_shared<MockInstance>();
+
+    range::db::TagIndexShard shard;
+    shard.set_format_version(range::db::NodeTagIndex::format_version);
+    for (auto name : { "prod#kafka1", "prod#kafka2" }) {
+        auto entry = shard.add_entries();
+        entry->set_name(name);
+        entry->add_live()->set_first(3);
+    }
+    shard.mutable_entries(1)->mutable_live(0)->set_last(4);                     // prod#kafka2 untagged at 4
+    std::string key = "tag_index:0:" + range::db::NodeTagIndex::group("ROLE", "kafka") + ":0";
+
+    EXPECT_CALL(*inst, get_record(record_type::GRAPH_META, "tag_index"))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return("3"));
+    EXPECT_CALL(*inst, get_record(record_type::NODE_META, key))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(shard.SerializeAsString()));
+    EXPECT_CALL(*inst, get_cursor())                                            // indexed; no scan
+        .Times(0);
+
+    range::graph::GraphDB gdb { "primary", inst, range::graph::GraphDB::node_factory_t(new range::graph::NodeIfaceConcreteFactory<MockNode>()) };
+
+    EXPECT_THAT(gdb.find_nodes_by_tag("ROLE", "kafka", 3), ElementsAre("prod#kafka1", "prod#kafka2"));
+    EXPECT_THAT(gdb.find_nodes_by_tag("ROLE", "kafka", 4), ElementsAre("prod#kafka1"));
+}
+
+//##############################################################################
+//##############################################################################
+TEST(TestIdAdjacency, test_interned_edges) {
+    typedef range::graph::NodeIface::node_type node_type;
+    MockBackend backend, other;
+    auto interner = range::graph::NameInterner::get(backend, "primary");
+    EXPECT_EQ(interner, range::graph::NameInterner::get(backend, "primary"));
+    EXPECT_NE(interner, range::graph::NameInterner::get(other, "primary"));     // another db home's graph
+    auto env1 = interner->intern("env1");
+    EXPECT_EQ(env1, interner->intern(std::string("env1")));
+    EXPECT_EQ("env1", interner->name(env1));
+    EXPECT_EQ(env1, interner->find("env1"));
+    EXPECT_EQ(range::graph::NameInterner::npos, interner->find("never_interned"));
+
+    auto graph = boost::make_shared<MockGraph>();
+    std::vector<range::graph::NodeIface::node_t> children;
+    for (auto name : { "env1#c1", "env1#c2" }) {
+        auto n = boost::make_shared<MockNode>();
+        EXPECT_CALL(*n, name()).WillRepeatedly(Return(name));
+        EXPECT_CALL(*n, type()).WillRepeatedly(Return(node_type::CLUSTER));
+        EXPECT_CALL(*n, forward_edges()).WillRepeatedly(Return(std::vector<range::graph::NodeIface::node_t>()));
+        EXPECT_CALL(*graph, get_node(std::string(name))).WillRepeatedly(Return(n));
+        children.push_back(n);
+    }
+    auto env = boost::make_shared<MockNode>();
+    EXPECT_CALL(*env, type()).WillRepeatedly(Return(node_type::ENVIRONMENT));
+    EXPECT_CALL(*env, forward_edges())
+        .Times(1)                                                               // read once per view
+        .WillOnce(Return(children));
+    EXPECT_CALL(*graph, get_node(std::string("env1"))).Times(1).WillOnce(Return(env));
+    EXPECT_CALL(*graph, get_node(std::string("missing"))).WillOnce(Return(range::graph::NodeIface::node_t()));
+
+    range::graph::IdAdjacency adj { graph, interner };
+    EXPECT_EQ(env1, adj.id("env1"));
+    EXPECT_EQ(node_type::ENVIRONMENT, adj.type(env1));
+    EXPECT_TRUE(adj.present(env1));
+    auto c1 = adj.id("env1#c1"), c2 = adj.id("env1#c2");
+    EXPECT_THAT(adj.forward(env1), ElementsAre(c1, c2));
+    EXPECT_THAT(adj.forward(env1), ElementsAre(c1, c2));
+    EXPECT_EQ(node_type::CLUSTER, adj.type(c2));
+    EXPECT_TRUE(adj.forward(c1).empty());
+
+    auto missing = adj.id("missing");
+    EXPECT_FALSE(adj.present(missing));
+    EXPECT_EQ(node_type::UNKNOWN, adj.type(missing));
+    EXPECT_TRUE(adj.forward(missing).empty());
+
+    range::graph::IdSet visited;
+    EXPECT_TRUE(visited.insert(c2));
+    EXPECT_FALSE(visited.insert(c2));
+    EXPECT_TRUE(visited.contains(c2));
+    EXPECT_FALSE(visited.contains(c1));
+    EXPECT_FALSE(visited.contains(1000));
+    EXPECT_TRUE(visited.insert(1000));
+    EXPECT_TRUE(visited.contains(1000));
+}
+
+//##############################################################################
+//##############################################################################
+TEST(TestCsrSnapshot, test_build_and_publish) {
+    typedef range::graph::NodeIface::node_type node_type;
+    typedef range::graph::NodeIface::node_t node_t;
+    typedef range::graph::CsrSnapshot CsrSnapshot;
+    auto graph = boost::make_shared<MockGraph>();
+
+    std::map<std::string, boost::shared_ptr<MockNode>> nodes;
+    for (auto name : { "env1", "env1#c1", "host1" }) {
+        nodes[name] = boost::make_shared<MockNode>();
+        EXPECT_CALL(*nodes[name], name()).WillRepeatedly(Return(name));
+        EXPECT_CALL(*graph, get_node(std::string(name))).Times(1).WillOnce(Return(nodes[name]));
+    }
+    auto gone = boost::make_shared<MockNode>();                                 // edge to a node not in the graph
+    EXPECT_CALL(*gone, name()).WillRepeatedly(Return("env1#gone"));
+
+    EXPECT_CALL(*nodes["env1"], forward_edges())
+        .WillOnce(Return(std::vector<node_t> { nodes["env1#c1"], gone }));
+    EXPECT_CALL(*nodes["env1"], reverse_edges()).WillOnce(Return(std::vector<node_t>()));
+    EXPECT_CALL(*nodes["env1#c1"], forward_edges()).WillOnce(Return(std::vector<node_t> { nodes["host1"] }));
+    EXPECT_CALL(*nodes["env1#c1"], reverse_edges()).WillOnce(Return(std::vector<node_t> { nodes["env1"] }));
+    EXPECT_CALL(*nodes["host1"], forward_edges()).WillOnce(Return(std::vector<node_t>()));
+    EXPECT_CALL(*nodes["host1"], reverse_edges()).WillOnce(Return(std::vector<node_t> { nodes["env1#c1"] }));
+
+    std::unordered_map<std::string, std::vector<std::string>> tags { { "ROLE", { "kafka", "zk" } }, { "DC", { "east" } } };
+    EXPECT_CALL(*nodes["env1"], tags()).WillOnce(Return(std::unordered_map<std::string, std::vector<std::string>>()));
+    EXPECT_CALL(*nodes["env1#c1"], tags()).WillOnce(Return(tags));
+    EXPECT_CALL(*nodes["host1"], tags()).WillOnce(Return(std::unordered_map<std::string, std::vector<std::string>>()));
+
+    EXPECT_CALL(*graph, version()).WillRepeatedly(Return(7));
+    EXPECT_CALL(*graph, nodes_by_type(7))
+        .Times(1)
+        .WillOnce(Return(MockGraph::nodes_by_type_t {
+                    { node_type::ENVIRONMENT, { "env1" } },
+                    { node_type::CLUSTER, { "env1#c1" } },
+                    { node_type::HOST, { "host1" } } }));
+
+    MockBackend backend, other;
+    auto snap = CsrSnapshot::build(*graph, range::graph::NameInterner::get(backend, "primary"));
+    EXPECT_EQ(7, snap->version());
+    EXPECT_EQ(4, snap->size());
+
+    auto env1 = snap->find("env1"), c1 = snap->find("env1#c1"), host1 = snap->find("host1");
+    auto missing = snap->find("env1#gone");
+    EXPECT_EQ(CsrSnapshot::npos, snap->find("env2"));
+    ASSERT_NE(CsrSnapshot::npos, missing);
+    EXPECT_FALSE(snap->present(missing));
+    EXPECT_TRUE(snap->present(host1));
+
+    EXPECT_EQ(node_type::CLUSTER, snap->type(c1));
+    EXPECT_EQ("env1#c1", snap->name(c1));
+    EXPECT_THAT(snap->forward(env1), ElementsAre(c1, missing));
+    EXPECT_THAT(snap->reverse(c1), ElementsAre(env1));
+    EXPECT_THAT(snap->forward(c1), ElementsAre(host1));
+    EXPECT_TRUE(snap->forward(missing).empty());
+    EXPECT_TRUE(snap->reverse(env1).empty());
+
+    ASSERT_EQ(2, snap->tags(c1).size());
+    EXPECT_EQ("DC", snap->tags(c1)[0].first);
+    EXPECT_THAT(*snap->tag(c1, "ROLE"), ElementsAre("kafka", "zk"));
+    EXPECT_EQ(nullptr, snap->tag(c1, "OWNER"));
+    EXPECT_TRUE(snap->tags(host1).empty());
+
+    EXPECT_FALSE(CsrSnapshot::current(backend, "primary"));
+    CsrSnapshot::publish(backend, "primary", snap);
+    EXPECT_EQ(snap, CsrSnapshot::current(backend, "primary"));
+    EXPECT_FALSE(CsrSnapshot::current(other, "primary"));
+
+    auto added = boost::make_shared<MockNode>();                                 // a name the snapshot hadn't seen
+    EXPECT_CALL(*added, name()).WillRepeatedly(Return("env1#c9"));
+    auto tagged = boost::make_shared<MockNode>();                                // host1 tagged, env1#gone created
+    EXPECT_CALL(*tagged, type()).WillRepeatedly(Return(node_type::HOST));
+    EXPECT_CALL(*tagged, forward_edges()).WillOnce(Return(std::vector<node_t> { added }));
+    EXPECT_CALL(*tagged, reverse_edges()).WillOnce(Return(std::vector<node_t> { nodes["env1#c1"] }));
+    EXPECT_CALL(*tagged, tags()).WillOnce(Return(tags));
+    EXPECT_CALL(*gone, type()).WillRepeatedly(Return(node_type::CLUSTER));
+    EXPECT_CALL(*gone, forward_edges()).WillOnce(Return(std::vector<node_t>()));
+    EXPECT_CALL(*gone, reverse_edges()).WillOnce(Return(std::vector<node_t> { nodes["env1"] }));
+    EXPECT_CALL(*gone, tags()).WillOnce(Return(std::unordered_map<std::string, std::vector<std::string>>()));
+    EXPECT_CALL(*graph, get_node(std::string("host1"))).Times(1).WillOnce(Return(tagged));
+    EXPECT_CALL(*graph, get_node(std::string("env1#gone"))).Times(1).WillOnce(Return(gone));
+    EXPECT_CALL(*graph, version()).WillRepeatedly(Return(8));
+
+    auto patched = snap->patch(*graph, { "host1", "env1#gone" });               // nothing else is read
+    EXPECT_EQ(8, patched->version());
+    EXPECT_EQ(5, patched->size());
+    EXPECT_EQ(env1, patched->find("env1"));                                     // unchanged nodes keep their ids
+    EXPECT_EQ(c1, patched->find("env1#c1"));
+    EXPECT_EQ(host1, patched->find("host1"));
+    EXPECT_EQ(missing, patched->find("env1#gone"));
+    EXPECT_EQ(&snap->tags(c1), &patched->tags(c1));                             // and share their tags
+    EXPECT_THAT(patched->forward(host1), ElementsAre(patched->find("env1#c9")));
+    EXPECT_FALSE(patched->present(patched->find("env1#c9")));
+    EXPECT_THAT(patched->forward(c1), ElementsAre(host1));
+    EXPECT_TRUE(patched->present(patched->find("env1#gone")));
+    EXPECT_EQ(node_type::CLUSTER, patched->type(patched->find("env1#gone")));
+    EXPECT_THAT(*patched->tag(patched->find("host1"), "DC"), ElementsAre("east"));
+    EXPECT_THAT(patched->forward(patched->find("env1")),
+            ElementsAre(patched->find("env1#c1"), patched->find("env1#gone")));
+    EXPECT_THAT(*patched->tag(patched->find("env1#c1"), "ROLE"), ElementsAre("kafka", "zk"));
+    EXPECT_TRUE(snap->tags(host1).empty());                                     // the old one is untouched
+}
+
+//##############################################################################
+//##############################################################################
+TEST(TestHostClosure, test_memoised_hosts) {
+    typedef range::graph::NodeIface::node_type node_type;
+    typedef range::graph::NodeIface::node_t node_t;
+    MockBackend backend;
+    auto interner = range::graph::NameInterner::get(backend, "primary");
+
+    std::map<std::string, boost::shared_ptr<MockNode>> nodes;                   // c1 and c2 under each other
+    for (auto name : { "env1", "env1#c1", "env1#c2", "env1#c3", "h1", "h2", "h3", "h4", "h5" }) {
+        nodes[name] = boost::make_shared<MockNode>();
+        EXPECT_CALL(*nodes[name], name()).WillRepeatedly(Return(name));
+        EXPECT_CALL(*nodes[name], type()).WillRepeatedly(Return(name[0] == 'h' ? node_type::HOST
+                    : name[4] == '#' ? node_type::CLUSTER : node_type::ENVIRONMENT));
+    }
+    auto edges = [&nodes](std::initializer_list<const char *> names) {
+        std::vector<node_t> ret;
+        for (auto name : names) {
+            ret.push_back(nodes[name]);
+        }
+        return ret;
+    };
+    EXPECT_CALL(*nodes["env1"], forward_edges()).WillRepeatedly(Return(edges({ "env1#c1", "env1#c2", "env1#c3" })));
+    EXPECT_CALL(*nodes["env1#c1"], forward_edges()).WillRepeatedly(Return(edges({ "h1", "env1#c2" })));
+    EXPECT_CALL(*nodes["env1#c2"], forward_edges()).WillRepeatedly(Return(edges({ "h2", "h3", "env1#c1" })));
+
+    auto c3_v7 = boost::make_shared<MockNode>(), c3_v8 = boost::make_shared<MockNode>();
+    EXPECT_CALL(*c3_v7, type()).WillRepeatedly(Return(node_type::CLUSTER));
+    EXPECT_CALL(*c3_v7, forward_edges()).WillRepeatedly(Return(edges({ "h4" })));
+    EXPECT_CALL(*c3_v8, type()).WillRepeatedly(Return(node_type::CLUSTER));
+    EXPECT_CALL(*c3_v8, forward_edges()).WillRepeatedly(Return(edges({ "h4", "h5" })));
+
+    auto v7 = boost::make_shared<MockGraph>(), v8 = boost::make_shared<MockGraph>();
+    for (auto &kv : nodes) {
+        auto n = (kv.first == "env1#c3") ? c3_v7 : kv.second;
+        EXPECT_CALL(*v7, get_node(kv.first)).WillRepeatedly(Return(n));
+        n = (kv.first == "env1#c3") ? c3_v8 : kv.second;
+        EXPECT_CALL(*v8, get_node(kv.first)).WillRepeatedly(Return(n));
+    }
+    auto unread = boost::make_shared<MockGraph>();                              // for answers that must come from the memo
+    EXPECT_CALL(*unread, get_node(_)).Times(0);
+
+    auto id = [&interner](const char *name) { return interner->intern(name); };
+    range::graph::HostClosure closure { interner };
+    closure.reset(7);
+    EXPECT_EQ(7, closure.through());
+
+    range::graph::IdAdjacency adj7 { v7, interner };
+    auto c2_hosts = closure.hosts(adj7, id("env1#c2"), 7);
+    EXPECT_THAT(*c2_hosts, UnorderedElementsAre(id("h1"), id("h2"), id("h3")));
+    EXPECT_THAT(*closure.hosts(adj7, id("env1"), 7),
+            UnorderedElementsAre(id("h1"), id("h2"), id("h3"), id("h4")));
+    EXPECT_THAT(*closure.hosts(adj7, id("h2"), 7), ElementsAre(id("h2")));
+
+    range::graph::IdAdjacency memo { unread, interner };
+    EXPECT_EQ(c2_hosts, closure.hosts(memo, id("env1#c2"), 7));
+    EXPECT_EQ(4, closure.hosts(memo, id("env1"), 7)->size());
+
+    closure.changed(8, { "env1#c3" });                                          // c2 doesn't reach c3
+    EXPECT_EQ(8, closure.through());
+    EXPECT_EQ(c2_hosts, closure.hosts(memo, id("env1#c2"), 8));
+    EXPECT_EQ(4, closure.hosts(memo, id("env1"), 7)->size());                   // still good for version 7
+
+    range::graph::IdAdjacency adj8 { v8, interner };
+    EXPECT_THAT(*closure.hosts(adj8, id("env1"), 8),
+            UnorderedElementsAre(id("h1"), id("h2"), id("h3"), id("h4"), id("h5")));
+    EXPECT_EQ(5, closure.hosts(memo, id("env1"), 8)->size());
+
+    EXPECT_EQ(5, closure.hosts(adj8, id("env1"), 9)->size());                   // past through(): walked, not kept
+    EXPECT_EQ(5, closure.hosts(memo, id("env1"), 8)->size());
+
+    EXPECT_EQ(2, closure.watchers(id("h1")));                                   // env1 and c2
+    EXPECT_EQ(1, closure.watchers(id("env1#c3")));
+    for (uint64_t v = 9; v < 13; ++v) {                                         // recomputed, not piled up
+        closure.changed(v, { "env1#c3" });
+        EXPECT_EQ(1, closure.watchers(id("h1")));
+        EXPECT_EQ(0, closure.watchers(id("env1#c3")));
+        EXPECT_EQ(5, closure.hosts(adj8, id("env1"), v)->size());
+        EXPECT_EQ(2, closure.watchers(id("h1")));
+        EXPECT_EQ(1, closure.watchers(id("env1#c3")));
+    }
+
+    range::graph::HostClosure late { interner };                                // first asked at a version already past
+    late.reset(7);
+    late.changed(8, { "env1#c3" });
+    EXPECT_THAT(*late.hosts(adj7, id("env1#c3"), 7), ElementsAre(id("h4")));
+    EXPECT_THAT(*late.hosts(adj8, id("env1#c3"), 8), UnorderedElementsAre(id("h4"), id("h5")));
+
+    Mock::VerifyAndClearExpectations(nodes["env1#c1"].get());                   // let go of the c1 <-> c2 cycle
+    Mock::VerifyAndClearExpectations(nodes["env1#c2"].get());
+}
 
 
 
@@ -540,4 +964,3 @@ main(int argc, char **argv)
     range::db::ProtobufNode::s_shutdown();
     return RUN_ALL_TESTS();
 }
-
@@ -0,0 +1,116 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <google/protobuf/message.h>
+#include <boost/make_shared.hpp>
+
+#include "../core/log.h"
+#include "../db/head_node.h"
+#include "../db/node_record.h"
+
+#include "record_store.h"
+
+using namespace ::testing;
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestRecordStore, TestHistorySplit) {
+    typedef range::db::GraphInstanceInterface::record_type record_type;
+    typedef range::db::HeadNode HeadNode;
+    auto node = boost::make_shared<HeadNode>("h1", inst);
+    auto child = boost::make_shared<HeadNode>("c1", inst);
+    node->update_tag("ROLE", { "kafka" });                                      // 1
+    node->add_forward_edge(child, false);                                       // 2
+    node->update_tag("ROLE", { "zk" });                                         // 3
+    node->remove_forward_edge(child, false);                                    // 4
+    EXPECT_EQ(4, node->version());
+
+    range::db::NodeInfo head;
+    ASSERT_TRUE(range::db::NodeRecord::decode(records[std::make_pair(rectype, "h1")], &head));
+    EXPECT_TRUE(head.head_only());
+    EXPECT_EQ(0, head.forward().edges_size());
+    ASSERT_EQ(1, head.tags().keys_size());
+    ASSERT_EQ(1, head.tags().keys(0).values_size());
+    EXPECT_EQ("zk", head.tags().keys(0).values(0).data());
+    for (uint64_t v : { 1, 2, 3 }) {
+        EXPECT_FALSE(records[std::make_pair(record_type::NODE_HISTORY, HeadNode::history_key("h1", v))].empty());
+    }
+
+    auto at2 = boost::make_shared<HeadNode>("h1", inst, 2);
+    EXPECT_THAT(at2->tags()["ROLE"], ElementsAre("kafka"));
+    ASSERT_EQ(1, at2->forward_edges().size());
+    EXPECT_EQ("c1", at2->forward_edges()[0]->name());
+    EXPECT_TRUE(boost::dynamic_pointer_cast<HeadNode>(at2->forward_edges()[0]));
+    EXPECT_EQ(4, at2->version());                                               // the header is always the head's
+
+    auto reader = boost::make_shared<HeadNode>("h1", inst);
+    EXPECT_THAT(reader->tags()["ROLE"], ElementsAre("zk"));
+    EXPECT_TRUE(reader->forward_edges().empty());
+    EXPECT_TRUE(reader->is_valid());
+    reader->set_wanted_version(3);
+    EXPECT_THAT(reader->tags()["ROLE"], ElementsAre("zk"));
+    EXPECT_EQ(1, reader->forward_edges().size());
+    reader->set_wanted_version(1);
+    EXPECT_THAT(reader->tags()["ROLE"], ElementsAre("kafka"));
+    EXPECT_TRUE(reader->forward_edges().empty());
+    reader->set_wanted_version(0);                                              // before it was first written
+    EXPECT_TRUE(reader->tags().empty());
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestRecordStore, TestFullHistoryRecord) {
+    typedef range::db::GraphInstanceInterface::record_type record_type;
+    typedef range::db::HeadNode HeadNode;
+    range::db::NodeInfo info = make_sectioned_test_info();
+    records[std::make_pair(rectype, "test1")] = info.SerializeAsString();
+    records[std::make_pair(rectype, "test2")] = info.SerializeAsString();
+
+    auto node = boost::make_shared<HeadNode>("test1", inst);
+    node->update_tag("ROLE", { "zk" });
+    EXPECT_EQ(info.SerializeAsString(),
+            records[std::make_pair(record_type::NODE_HISTORY, HeadNode::history_base_key("test1"))]);
+
+    auto at2 = boost::make_shared<HeadNode>("test1", inst, 2);
+    EXPECT_THAT(at2->tags()["ROLE"], ElementsAre("kafka"));
+    ASSERT_EQ(1, at2->forward_edges().size());
+    auto at3 = boost::make_shared<HeadNode>("test1", inst, 3);
+    EXPECT_THAT(at3->tags()["ROLE"], ElementsAre("zk"));
+    ASSERT_EQ(1, at3->forward_edges().size());
+
+    auto legacy = boost::make_shared<HeadNode>("test2", inst);
+    EXPECT_TRUE(legacy->upgrade_format(0));                                     // splits it even in the current format
+    EXPECT_FALSE(legacy->upgrade_format(0));
+    auto upgraded = boost::make_shared<HeadNode>("test2", inst, 1);
+    EXPECT_THAT(upgraded->tags()["ROLE"], ElementsAre());                       // as the full record had it
+}
+
+//##############################################################################
+//##############################################################################
+int
+main(int argc, char **argv)
+{
+    range::initialize_logger("/dev/null", 0);
+    GOOGLE_PROTOBUF_VERIFY_VERSION;
+    ::testing::InitGoogleTest(&argc, argv);
+    range::db::ProtobufNode::s_shutdown();
+    return RUN_ALL_TESTS();
+}
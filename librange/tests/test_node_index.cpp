@@ -0,0 +1,273 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <google/protobuf/message.h>
+#include <boost/make_shared.hpp>
+
+#include "../core/log.h"
+#include "../db/pbuff_node.h"
+#include "../db/node_type_index.h"
+#include "../db/node_tag_index.h"
+#include "../util/crc32.h"
+
+#include "record_store.h"
+
+using namespace ::testing;
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestRecordStore, TestTypeIndexAddRemove) {
+    typedef range::graph::NodeIface::node_type node_type;
+    range::db::NodeTypeIndex index { inst };
+    EXPECT_EQ(static_cast<uint64_t>(-1), index.complete_from());
+
+    index.add(node_type::HOST, "host1", 1);                                     // only createGraphInstance marks it built
+    EXPECT_EQ(static_cast<uint64_t>(-1), index.complete_from());
+    index.set_complete_from(0);
+    EXPECT_EQ(0, index.complete_from());
+
+    index.add(node_type::HOST, "host2", 2);
+    index.add(node_type::HOST, "host2", 2);
+    index.add(node_type::ENVIRONMENT, "env1", 2);
+    index.remove(node_type::HOST, "host1", 3);
+    index.add(node_type::HOST, "host3", 4);
+    index.remove(node_type::HOST, "host3", 4);                                  // added and removed in the same version
+
+    range::db::NodeTypeIndex reader { inst };
+    EXPECT_THAT(reader.find(node_type::HOST, 1), ElementsAre("host1"));
+    EXPECT_THAT(reader.find(node_type::HOST, 2), ElementsAre("host1", "host2"));
+    EXPECT_THAT(reader.find(node_type::HOST, 3), ElementsAre("host2"));
+    EXPECT_THAT(reader.find(node_type::HOST, 4), ElementsAre("host2"));
+    EXPECT_THAT(reader.find(node_type::ENVIRONMENT, 4), ElementsAre("env1"));
+    EXPECT_TRUE(reader.find(node_type::CLUSTER, 4).empty());
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestRecordStore, TestTypeIndexSetType) {
+    typedef range::graph::NodeIface::node_type node_type;
+    range::db::NodeInfo test;
+    test.set_list_version(1);
+    test.set_format_version(range::db::ProtobufNode::format_version);
+    test.set_node_type(static_cast<int>(node_type::UNKNOWN));
+    test.mutable_tags();
+    test.mutable_forward();
+    test.mutable_reverse();
+    test.add_live()->set_first(0);
+    test.set_crc32(0);
+    test.set_crc32(range::util::crc32(test.SerializeAsString()));
+    records[std::make_pair(rectype, "test1")] = test.SerializeAsString();
+
+    range::db::NodeTypeIndex index { inst };
+    index.add(node_type::UNKNOWN, "test1", 0);
+    EXPECT_THAT(index.find(node_type::UNKNOWN, 0), ElementsAre("test1"));
+
+    auto node = boost::make_shared<range::db::ProtobufNode>("test1", inst);
+    node->set_type(node_type::HOST);
+
+    range::db::NodeTypeIndex reader { inst };
+    EXPECT_TRUE(reader.find(node_type::UNKNOWN, 0).empty());
+    EXPECT_THAT(reader.find(node_type::HOST, 0), ElementsAre("test1"));
+
+    range::db::NodeTypeIndex rebuilt { inst };                                  // as range_upgrade does it
+    rebuilt.clear();
+    node->add_to_type_index(rebuilt);
+    rebuilt.flush();
+    EXPECT_THAT(range::db::NodeTypeIndex(inst).find(node_type::HOST, 5), ElementsAre("test1"));
+    EXPECT_TRUE(range::db::NodeTypeIndex(inst).find(node_type::UNKNOWN, 5).empty());
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestRecordStore, TestTypeIndexSplitShards) {
+    typedef range::graph::NodeIface::node_type node_type;
+    typedef range::db::NodeTypeIndex NodeTypeIndex;
+    range::db::NodeInfo live;
+    live.add_live()->set_first(1);
+
+    range::db::NodeTypeIndex index { inst };                                    // as range_upgrade does it
+    index.clear();
+    std::vector<std::string> names;
+    for (uint32_t i = 0; i < NodeTypeIndex::min_shards * NodeTypeIndex::max_shard_entries; ++i) {
+        names.push_back("host" + std::to_string(static_cast<unsigned long long>(i)));
+        index.add_intervals(node_type::HOST, names.back(), live.live());
+    }
+    index.flush();
+    std::sort(names.begin(), names.end());
+
+    std::string group = std::to_string(static_cast<int>(node_type::HOST));
+    uint32_t n = std::stoul(records[std::make_pair(range::db::GraphInstanceInterface::record_type::NODE_META,
+                "type_index:" + group)]);
+    EXPECT_LT(NodeTypeIndex::min_shards, n);
+    for (uint32_t s = 0; s < n; ++s) {
+        range::db::TypeIndexShard shard;
+        ASSERT_TRUE(shard.ParseFromString(records[std::make_pair(range::db::GraphInstanceInterface::record_type::NODE_META,
+                        "type_index:" + group + ":" + std::to_string(static_cast<unsigned long long>(s)))]));
+        EXPECT_GE(NodeTypeIndex::max_shard_entries, shard.entries_size());
+        for (int i = 1; i < shard.entries_size(); ++i) {
+            EXPECT_LT(shard.entries(i - 1).name(), shard.entries(i).name());
+        }
+    }
+    EXPECT_EQ(names, range::db::NodeTypeIndex(inst).find(node_type::HOST, 1));
+
+    range::db::NodeTypeIndex writer { inst };
+    writer.remove(node_type::HOST, "host1", 2);
+    writer.add(node_type::HOST, "extra", 2);
+    auto found = range::db::NodeTypeIndex(inst).find(node_type::HOST, 2);
+    EXPECT_EQ(names.size(), found.size());
+    EXPECT_TRUE(std::binary_search(found.begin(), found.end(), "extra"));
+    EXPECT_FALSE(std::binary_search(found.begin(), found.end(), "host1"));
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestRecordStore, TestTagIndexAddUpdateRemove) {
+    range::db::NodeTagIndex index { inst };
+    EXPECT_EQ(static_cast<uint64_t>(-1), index.complete_from());
+
+    index.add_node("c1", { { "ROLE", { "kafka", "zk" } } }, 1);                 // only createGraphInstance marks it built
+    EXPECT_EQ(static_cast<uint64_t>(-1), index.complete_from());
+    index.set_complete_from(0);
+    EXPECT_EQ(0, index.complete_from());
+    index.add_node("c2", { { "ROLE", { "kafka" } } }, 2);
+    index.update("c1", "ROLE", { "kafka", "zk" }, { "kafka" }, 3);
+    index.remove_node("c1", { { "ROLE", { "kafka" } } }, 5);
+    index.update("c2", "ROLE", { "kafka" }, { "kafka", "web" }, 6);
+    index.update("c2", "ROLE", { "kafka", "web" }, { "kafka" }, 6);             // added and removed in the same version
+
+    range::db::NodeTagIndex reader { inst };
+    EXPECT_THAT(reader.find("ROLE", "kafka", 1), ElementsAre("c1"));
+    EXPECT_THAT(reader.find("ROLE", "kafka", 2), ElementsAre("c1", "c2"));
+    EXPECT_THAT(reader.find("ROLE", "zk", 2), ElementsAre("c1"));
+    EXPECT_TRUE(reader.find("ROLE", "zk", 3).empty());
+    EXPECT_THAT(reader.find("ROLE", "kafka", 4), ElementsAre("c1", "c2"));
+    EXPECT_THAT(reader.find("ROLE", "kafka", 5), ElementsAre("c2"));
+    EXPECT_TRUE(reader.find("ROLE", "web", 6).empty());
+    EXPECT_TRUE(reader.find("OWNER", "kafka", 2).empty());
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestRecordStore, TestTagIndexUpdateTag) {
+    range::db::NodeInfo test;
+    test.set_list_version(1);
+    test.set_format_version(range::db::ProtobufNode::format_version);
+    test.set_node_type(static_cast<int>(range::graph::NodeIface::node_type::CLUSTER));
+    test.mutable_tags();
+    test.mutable_forward();
+    test.mutable_reverse();
+    test.set_crc32(0);
+    test.set_crc32(range::util::crc32(test.SerializeAsString()));
+    records[std::make_pair(rectype, "outside")] = test.SerializeAsString();     // not part of the graph
+    test.add_live()->set_first(0);
+    test.set_crc32(0);
+    test.set_crc32(range::util::crc32(test.SerializeAsString()));
+    records[std::make_pair(rectype, "test1")] = test.SerializeAsString();
+
+    auto outside = boost::make_shared<range::db::ProtobufNode>("outside", inst);
+    outside->update_tag("ROLE", { "kafka" });
+    auto node = boost::make_shared<range::db::ProtobufNode>("test1", inst);
+    node->update_tag("ROLE", { "kafka" });
+    EXPECT_THAT(range::db::NodeTagIndex(inst).find("ROLE", "kafka", 0), ElementsAre("test1"));
+
+    node->update_tag("ROLE", { "zk" });
+    EXPECT_TRUE(range::db::NodeTagIndex(inst).find("ROLE", "kafka", 0).empty());
+    EXPECT_THAT(range::db::NodeTagIndex(inst).find("ROLE", "zk", 0), ElementsAre("test1"));
+
+    node->delete_tag("ROLE");
+    EXPECT_TRUE(range::db::NodeTagIndex(inst).find("ROLE", "zk", 0).empty());
+
+    node->update_tag("ROLE", { "kafka" });
+    auto old_records = [this]() {
+        size_t n = 0;
+        for (auto &record : records) {
+            n += record.first.first == range::db::GraphInstanceInterface::record_type::NODE_META
+                && record.first.second.compare(0, 12, "tag_index:0:") == 0 && !record.second.empty();
+        }
+        return n;
+    };
+    EXPECT_LT(0u, old_records());
+    range::db::NodeTagIndex rebuilt { inst };                                   // as range_upgrade does it
+    rebuilt.clear();
+    EXPECT_EQ(0u, old_records());                                               // not left behind in the old epoch
+    node->add_to_tag_index(rebuilt, 0);
+    outside->add_to_tag_index(rebuilt, 0);
+    rebuilt.flush();
+    EXPECT_THAT(range::db::NodeTagIndex(inst).find("ROLE", "kafka", 0), ElementsAre("test1"));
+    EXPECT_TRUE(range::db::NodeTagIndex(inst).find("ROLE", "zk", 0).empty());
+    EXPECT_EQ("1", records[std::make_pair(range::db::GraphInstanceInterface::record_type::GRAPH_META,
+                "tag_index_epoch")]);
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestRecordStore, TestTagIndexPopularTag) {
+    typedef range::db::NodeTagIndex NodeTagIndex;
+    typedef range::db::GraphInstanceInterface::record_type record_type;
+    range::db::NodeTagIndex index { inst };                                     // as range_upgrade does it
+    index.clear();
+    std::vector<std::string> names;
+    for (int i = 0; i < 4 * NodeTagIndex::max_shard_entries; ++i) {
+        names.push_back("c" + std::to_string(static_cast<unsigned long long>(i)));
+        index.add_tags(names.back(), { { "ROLE", { "kafka" } } }, 1);
+    }
+    index.add_tags("zk1", { { "ROLE", { "zk" } } }, 1);
+    index.flush();
+    std::sort(names.begin(), names.end());
+
+    std::string prefix = "tag_index:" + records[std::make_pair(record_type::GRAPH_META, "tag_index_epoch")] + ":";
+    std::string group = NodeTagIndex::group("ROLE", "kafka");
+    uint32_t n = std::stoul(records[std::make_pair(record_type::NODE_META, prefix + group)]);
+    EXPECT_LE(4u, n);
+    for (uint32_t s = 0; s < n; ++s) {
+        range::db::TagIndexShard shard;
+        ASSERT_TRUE(shard.ParseFromString(records[std::make_pair(record_type::NODE_META,
+                        prefix + group + ":" + std::to_string(static_cast<unsigned long long>(s)))]));
+        EXPECT_GE(NodeTagIndex::max_shard_entries, shard.entries_size());
+    }
+    EXPECT_TRUE(records[std::make_pair(record_type::NODE_META,                 // the other tag stays in one record
+                prefix + NodeTagIndex::group("ROLE", "zk"))].empty());
+    EXPECT_EQ(names, range::db::NodeTagIndex(inst).find("ROLE", "kafka", 1));
+    EXPECT_THAT(range::db::NodeTagIndex(inst).find("ROLE", "zk", 1), ElementsAre("zk1"));
+
+    auto before = records;
+    range::db::NodeTagIndex(inst).update("c1", "ROLE", { "kafka" }, { }, 2);
+    int changed = 0;
+    for (auto &record : records) {
+        changed += before[record.first] != record.second;
+    }
+    EXPECT_EQ(1, changed);                                                      // one small record rewritten
+    EXPECT_EQ(names.size() - 1, range::db::NodeTagIndex(inst).find("ROLE", "kafka", 2).size());
+}
+
+//##############################################################################
+//##############################################################################
+int
+main(int argc, char **argv)
+{
+    range::initialize_logger("/dev/null", 0);
+    GOOGLE_PROTOBUF_VERIFY_VERSION;
+    ::testing::InitGoogleTest(&argc, argv);
+    range::db::ProtobufNode::s_shutdown();
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,212 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <gmock/gmock.h>
+#include <google/protobuf/message.h>
+#include <boost/make_shared.hpp>
+
+#include "../core/log.h"
+#include "../db/node_info_cache.h"
+#include "../db/pbuff_node.h"
+#include "../util/crc32.h"
+
+#include "mock_transaction.h"
+#include "mock_instance_lock.h"
+#include "mock_instance.h"
+
+using namespace ::testing;
+
+//##############################################################################
+//##############################################################################
+class CachingMockInstance : public MockInstance {
+    public:
+        virtual std::string graph_name() const override { return "cached_graph"; }
+        virtual uint64_t cache_generation(record_type, const std::string&) const override {
+            return 1;
+        }
+};
+
+//##############################################################################
+//##############################################################################
+class TestNodeInfoCache : public ::testing::Test {
+    public:
+        virtual void SetUp() override
+        {
+            cache = range::db::NodeInfoCache::get();
+            cache->set_capacity(65536);
+            cache->clear();
+        }
+
+        static range::db::NodeInfoCache::info_t make_info(uint64_t list_version) {
+            range::db::NodeInfo info;
+            info.set_list_version(list_version);
+            info.set_node_type(static_cast<int>(range::graph::NodeIface::node_type::CLUSTER));
+            info.set_crc32(0);
+            info.mutable_tags();
+            info.mutable_forward();
+            info.mutable_reverse();
+            return boost::make_shared<range::db::NodeRecord>(info.SerializeAsString());
+        }
+
+        boost::shared_ptr<range::db::NodeInfoCache> cache;
+};
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestNodeInfoCache, test_hit_and_miss) {
+    uint64_t gen = 1;
+    uint64_t hits = cache->hits();
+    uint64_t misses = cache->misses();
+
+    EXPECT_EQ(nullptr, cache->lookup("g", "foo", gen));
+    cache->insert("g", "foo", gen, make_info(3));
+
+    auto found = cache->lookup("g", "foo", gen);
+    ASSERT_NE(nullptr, found);
+    EXPECT_EQ(3, found->header().list_version());
+
+    EXPECT_EQ(nullptr, cache->lookup("other", "foo", gen));
+    EXPECT_EQ(hits + 1, cache->hits());
+    EXPECT_EQ(misses + 2, cache->misses());
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestNodeInfoCache, test_generations) {
+    cache->insert("g", "foo", 5, make_info(1));
+    ASSERT_NE(nullptr, cache->lookup("g", "foo", 5));
+    EXPECT_EQ(nullptr, cache->lookup("g", "foo", 6));                           // written since
+
+    cache->insert("g", "foo", 6, make_info(2));
+    EXPECT_EQ(nullptr, cache->lookup("g", "foo", 5));
+    cache->insert("g", "foo", 5, make_info(1));                                 // reader from before the write
+    auto found = cache->lookup("g", "foo", 6);
+    ASSERT_NE(nullptr, found);
+    EXPECT_EQ(2, found->header().list_version());
+    EXPECT_EQ(1, cache->size());
+
+    cache->clear();
+    EXPECT_EQ(0, cache->size());
+    EXPECT_EQ(nullptr, cache->lookup("g", "foo", 6));
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestNodeInfoCache, test_eviction) {
+    uint64_t gen = 1;
+    uint64_t evictions = cache->evictions();
+    cache->set_capacity(16);
+
+    for (int i = 0; i < 1024; ++i) {
+        cache->insert("g", std::to_string(static_cast<long long>(i)), gen, make_info(i));
+    }
+    EXPECT_GE(16, cache->size());
+    EXPECT_LT(evictions, cache->evictions());
+
+    cache->set_capacity(0);
+    EXPECT_EQ(0, cache->size());
+    cache->insert("g", "foo", gen, make_info(1));
+    EXPECT_EQ(nullptr, cache->lookup("g", "foo", gen));
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestNodeInfoCache, test_shared_between_nodes) {
+    auto inst = boost::make_shared<CachingMockInstance>();
+
+    range::db::NodeInfo stored;
+    stored.set_list_version(2);
+    stored.set_node_type(static_cast<int>(range::graph::NodeIface::node_type::CLUSTER));
+    stored.mutable_tags();
+    stored.mutable_reverse();
+    auto f = stored.mutable_forward()->add_edges();
+    f->set_id("child");
+    f->add_versions(2);
+    stored.set_crc32(0);
+    stored.set_crc32(range::util::crc32(stored.SerializeAsString()));
+
+    EXPECT_CALL(*inst, get_record(range::db::GraphInstanceInterface::record_type::NODE, "parent"))
+        .Times(1)
+        .WillOnce(Return(stored.SerializeAsString()));
+
+    auto node1 = boost::make_shared<range::db::ProtobufNode>("parent", inst);
+    auto node2 = boost::make_shared<range::db::ProtobufNode>("parent", inst);
+
+    EXPECT_EQ(2, node1->version());
+    EXPECT_EQ(2, node2->version());
+    EXPECT_EQ(range::graph::NodeIface::node_type::CLUSTER, node2->type());
+    ASSERT_EQ(1, node2->forward_edges().size());
+    EXPECT_EQ("child", node2->forward_edges()[0]->name());
+    EXPECT_TRUE(node2->is_valid());
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestNodeInfoCache, test_primed_record) {
+    auto inst = boost::make_shared<MockInstance>();
+
+    range::db::NodeInfo stored;
+    stored.set_list_version(4);
+    stored.set_node_type(static_cast<int>(range::graph::NodeIface::node_type::HOST));
+    stored.mutable_tags();
+    stored.mutable_forward();
+    stored.mutable_reverse();
+    stored.set_crc32(0);
+    stored.set_crc32(range::util::crc32(stored.SerializeAsString()));
+
+    EXPECT_CALL(*inst, get_record(_, _)).Times(0);
+
+    auto node = boost::make_shared<range::db::ProtobufNode>("host", inst, stored.SerializeAsString());
+    EXPECT_EQ(4, node->version());
+    EXPECT_EQ(range::graph::NodeIface::node_type::HOST, node->type());
+    EXPECT_TRUE(node->is_valid());
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestNodeInfoCache, test_sectioned_record) {
+    auto inst = boost::make_shared<CachingMockInstance>();
+
+    range::db::NodeInfo stored;
+    stored.set_list_version(2);
+    stored.set_node_type(static_cast<int>(range::graph::NodeIface::node_type::CLUSTER));
+    stored.mutable_tags();
+    stored.mutable_reverse();
+    auto f = stored.mutable_forward()->add_edges();
+    f->set_id("child");
+    f->add_versions(2);
+    stored.set_crc32(0);
+    stored.set_crc32(range::util::crc32(stored.SerializeAsString()));
+
+    EXPECT_CALL(*inst, get_record(range::db::GraphInstanceInterface::record_type::NODE, "sectioned"))
+        .Times(1)
+        .WillOnce(Return(range::db::NodeRecord::encode(stored,
+                        range::db::NodeRecord::node_encoding::SECTIONED)));
+
+    auto node1 = boost::make_shared<range::db::ProtobufNode>("sectioned", inst);
+    auto node2 = boost::make_shared<range::db::ProtobufNode>("sectioned", inst);
+
+    EXPECT_EQ(2, node1->version());
+    EXPECT_TRUE(node1->tags().empty());
+    ASSERT_EQ(1, node2->forward_edges().size());
+    EXPECT_EQ("child", node2->forward_edges()[0]->name());
+    EXPECT_TRUE(node2->reverse_edges().empty());
+    EXPECT_TRUE(node2->is_valid());
+}
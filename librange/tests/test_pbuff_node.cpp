@@ -15,6 +15,7 @@
  * along with range++.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <map>
 #include <string>
 #include <vector>
 #include <memory>
@@ -29,6 +30,7 @@
 
 #include "../core/log.h"
 #include "../db/pbuff_node.h"
+#include "../db/node_record.h"
 #include "../db/db_interface.h"
 #include "../util/crc32.h"
 
@@ -36,6 +38,7 @@
 #include "mock_instance_lock.h"
 #include "mock_cursor.h"
 #include "mock_instance.h"
+#include "record_store.h"
 
 using namespace ::testing;
 
@@ -768,8 +771,146 @@ TEST_F(TestProtobufNode, TestNodeVersionedRemoval) {
 }
 
 
+//##############################################################################
+//##############################################################################
+TEST_F(TestProtobufNode, TestGraphVersionIntervals) {
+    range::db::NodeInfo test;                                                   // format 0: explicit graph versions
+    test.set_list_version(1);
+    test.set_node_type(static_cast<int>(range::graph::NodeIface::node_type::HOST));
+    test.mutable_tags();
+    test.mutable_forward();
+    test.mutable_reverse();
+    for (uint64_t v : { 1, 2, 3, 5, 6 }) {
+        test.add_graph_versions(v);
+    }
+    test.set_crc32(0);
+    test.set_crc32(range::util::crc32(test.SerializeAsString()));
 
+    EXPECT_CALL(*inst, get_record(rectype, "test1"))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(test.SerializeAsString()));
 
+    EXPECT_CALL(*inst, write_record(rectype, "test1", 1, _))
+        .Times(3)
+        .WillRepeatedly(Return(true));
+
+    EXPECT_CALL(*inst, get_record(range::db::GraphInstanceInterface::record_type::NODE_META, _))
+        .Times(AtLeast(1))
+        .WillRepeatedly(Return(""));
+
+    EXPECT_CALL(*inst, write_record(range::db::GraphInstanceInterface::record_type::NODE_META, _, 0, _))
+        .Times(1)                                                               // type index, on write 3
+        .WillOnce(Return(true));
+
+    auto node = boost::make_shared<range::db::ProtobufNode>("test1", inst);
+    EXPECT_TRUE(node->live_at(3));
+    EXPECT_FALSE(node->live_at(4));
+    EXPECT_FALSE(node->live_at(7));
+
+    EXPECT_TRUE(node->upgrade_format(6));                                       // write 1
+    EXPECT_FALSE(node->upgrade_format(6));
+    EXPECT_TRUE(node->live_at(3));
+    EXPECT_FALSE(node->live_at(4));
+    EXPECT_TRUE(node->live_at(6));
+    EXPECT_TRUE(node->live_at(7));                                              // still part of the graph
+
+    node->add_graph_version(7);                                                 // nothing to write
+    node->remove_graph_version(8);                                              // write 2
+    EXPECT_TRUE(node->live_at(7));
+    EXPECT_FALSE(node->live_at(8));
+    EXPECT_FALSE(node->live_at_or_after(8));
+    EXPECT_TRUE(node->live_at_or_after(7));
+
+    node->add_graph_version(9);                                                 // write 3
+    EXPECT_FALSE(node->live_at(8));
+    EXPECT_TRUE(node->live_at(9));
+    EXPECT_THAT(node->graph_versions(), ElementsAre(1, 2, 3, 5, 6, 7, 9));
+}
+
+//##############################################################################
+//##############################################################################
+TEST(TestNodeRecord, TestSections) {
+    typedef range::db::NodeRecord::node_encoding node_encoding;
+    range::db::NodeInfo info = make_sectioned_test_info();
+    std::string expected = info.SerializeAsString();
+
+    std::string buf = range::db::NodeRecord::encode(info, node_encoding::SECTIONED);
+    EXPECT_EQ(expected, info.SerializeAsString());                              // info is left as it was
+    EXPECT_EQ(node_encoding::SECTIONED, range::db::NodeRecord::encoding_of(buf));
+    EXPECT_EQ(node_encoding::PROTOBUF, range::db::NodeRecord::encoding_of(expected));
+
+    range::db::NodeInfo decoded;
+    EXPECT_TRUE(range::db::NodeRecord::decode(buf, &decoded));
+    EXPECT_EQ(expected, decoded.SerializeAsString());
+
+    range::db::NodeRecord record { std::string(buf) };
+    ASSERT_TRUE(record.valid());
+    EXPECT_EQ(2, record.header().list_version());
+    EXPECT_EQ(0, record.header().tags().keys_size());                           // sections are not in the header
+    ASSERT_EQ(1, record.tags().keys_size());
+    EXPECT_EQ("kafka", record.tags().keys(0).values(0).data());
+    ASSERT_EQ(1, record.forward().edges_size());
+    EXPECT_EQ("child", record.forward().edges(0).id());
+    EXPECT_EQ(0, record.reverse().edges_size());
+    record.decode(&decoded);
+    EXPECT_EQ(expected, decoded.SerializeAsString());
+
+    range::db::NodeRecord protobuf { std::string(expected) };
+    ASSERT_TRUE(protobuf.valid());
+    EXPECT_EQ("child", protobuf.forward().edges(0).id());
+    EXPECT_EQ("kafka", protobuf.tags().keys(0).values(0).data());
+
+    EXPECT_FALSE(range::db::NodeRecord(buf.substr(0, buf.size() - 1)).valid());
+    EXPECT_FALSE(range::db::NodeRecord(std::string()).valid());
+}
+
+//##############################################################################
+//##############################################################################
+class SectionedMockInstance : public MockInstance {
+    public:
+        virtual node_encoding node_record_encoding() const override {
+            return node_encoding::SECTIONED;
+        }
+};
+
+//##############################################################################
+//##############################################################################
+class TestSectionedNode : public TestRecordStore {
+    public:
+        virtual void SetUp() override
+        {
+            back_with_records(boost::make_shared<SectionedMockInstance>());
+        }
+};
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestSectionedNode, TestReadWrite) {
+    typedef range::db::NodeRecord::node_encoding node_encoding;
+    range::db::NodeInfo info = make_sectioned_test_info();
+    records[std::make_pair(rectype, "test1")] = info.SerializeAsString();
+
+    auto node = boost::make_shared<range::db::ProtobufNode>("test1", inst);
+    EXPECT_TRUE(node->upgrade_format(0));                                       // a protobuf record in a sectioned graph
+    EXPECT_EQ(node_encoding::SECTIONED,
+            range::db::NodeRecord::encoding_of(records[std::make_pair(rectype, "test1")]));
+    EXPECT_FALSE(node->upgrade_format(0));
+
+    auto reader = boost::make_shared<range::db::ProtobufNode>("test1", inst);
+    EXPECT_EQ(2, reader->version());
+    EXPECT_EQ(range::graph::NodeIface::node_type::CLUSTER, reader->type());
+    EXPECT_THAT(reader->tags()["ROLE"], ElementsAre("kafka"));
+    ASSERT_EQ(1, reader->forward_edges().size());
+    EXPECT_EQ("child", reader->forward_edges()[0]->name());
+    EXPECT_TRUE(reader->is_valid());
+
+    reader->update_tag("ROLE", { "zk" });
+    EXPECT_EQ(node_encoding::SECTIONED,
+            range::db::NodeRecord::encoding_of(records[std::make_pair(rectype, "test1")]));
+    auto updated = boost::make_shared<range::db::ProtobufNode>("test1", inst);
+    EXPECT_THAT(updated->tags()["ROLE"], ElementsAre("zk"));
+    EXPECT_TRUE(updated->is_valid());
+}
 
 //##############################################################################
 //##############################################################################
@@ -782,8 +923,3 @@ main(int argc, char **argv)
     range::db::ProtobufNode::s_shutdown();
     return RUN_ALL_TESTS();
 }
-
-
-
-
-
@@ -782,6 +782,26 @@ TEST_F(TestRangeReadAPI, test_expand_env) {
     }
 }
 
+//##############################################################################
+//##############################################################################
+TEST_F(TestRangeReadAPI, test_expand_hosts) {
+    auto a = api->expand_hosts("env1", "topcluster1");
+
+    ASSERT_EQ(typeid(range::RangeArray), a.type());
+
+    std::vector<std::string> values;
+    for(auto v : boost::get<range::RangeArray>(a).values) {
+        values.push_back(boost::get<range::RangeString>(v).value);
+    }
+    EXPECT_EQ(625, values.size());                                              // each host once, though under 5 clusters
+    EXPECT_TRUE(std::is_sorted(values.begin(), values.end()));
+    EXPECT_EQ("host0000.example.com", values.front());
+    EXPECT_EQ("host4444.example.com", values.back());
+
+    auto b = api->expand_hosts("env1", "topcluster1");                          // from the memo this time
+    EXPECT_EQ(values.size(), boost::get<range::RangeArray>(b).values.size());
+}
+
 //##############################################################################
 //##############################################################################
 TEST_F(TestRangeReadAPI, test_get_clusters) {
@@ -32,6 +32,7 @@ using namespace ::testing;
 
 #include "mock_node.h"
 #include "mock_graph.h"
+#include "mock_graphtxn.h"
 #include "mock_config.h"
 #include "mock_backend.h"
 #include "mock_graphdb_factory.h"
@@ -1070,6 +1071,88 @@ TEST_F(TestRangeWriteAPI, test_remove_node_env_dependency)
 }
 
 
+//##############################################################################
+//##############################################################################
+TEST_F(TestRangeWriteAPI, test_apply_batch) {
+    auto env1 = boost::make_shared<MockNode>();
+    auto env2 = boost::make_shared<MockNode>();
+    EXPECT_CALL(*env1, set_type(range::graph::NodeIface::node_type::ENVIRONMENT))
+        .Times(2)
+        .WillRepeatedly(Return(range::graph::NodeIface::node_type::UNKNOWN));
+    EXPECT_CALL(*env2, set_type(range::graph::NodeIface::node_type::ENVIRONMENT))
+        .Times(2)
+        .WillRepeatedly(Return(range::graph::NodeIface::node_type::UNKNOWN));
+
+    EXPECT_CALL(*primary, create("env1")).Times(1).WillOnce(Return(env1));
+    EXPECT_CALL(*dependency, create("env1")).Times(1).WillOnce(Return(env1));
+    EXPECT_CALL(*primary, create("env2")).Times(1).WillOnce(Return(env2));
+    EXPECT_CALL(*dependency, create("env2")).Times(1).WillOnce(Return(env2));
+
+    EXPECT_CALL(*backend, startRangeTransaction(_))                             // one range version for the whole batch
+        .Times(1)
+        .WillOnce(Return(nullptr));
+    EXPECT_CALL(*primary, start_txn())                                          // and one version of each graph
+        .Times(1)
+        .WillOnce(Return(nullptr));
+    EXPECT_CALL(*dependency, start_txn())
+        .Times(1)
+        .WillOnce(Return(nullptr));
+
+    ::range::RangeAPI_v1 api { cfg };
+
+    std::vector<range::RangeAPI_v1::Mutation> batch {
+        { "create_env", { "env1" } },
+        { "create_env", { "env2" } },
+    };
+    auto args = range::RangeAPI_v1::encode_batch(batch);
+    std::vector<std::string> expected { "create_env", "1", "env1", "create_env", "1", "env2" };
+    EXPECT_EQ(expected, args);
+    ASSERT_EQ(2, range::RangeAPI_v1::decode_batch(args).size());
+
+    bool a = range::RangeAPI_v1::write_api_symtable.find("apply_batch")->second(&api, args, 0);
+    EXPECT_EQ(a, true);
+
+    args[1] = "2";
+    EXPECT_THROW(range::RangeAPI_v1::decode_batch(args), range::IncorrectNumberOfArguments);
+    EXPECT_THROW(range::RangeAPI_v1::encode_batch({ { "apply_batch", {} } }), range::IncorrectNumberOfArguments);
+}
+
+//##############################################################################
+//##############################################################################
+TEST_F(TestRangeWriteAPI, test_apply_batch_aborts) {
+    auto env1 = boost::make_shared<MockNode>();
+    EXPECT_CALL(*env1, set_type(range::graph::NodeIface::node_type::ENVIRONMENT))
+        .Times(2)
+        .WillRepeatedly(Return(range::graph::NodeIface::node_type::UNKNOWN));
+
+    EXPECT_CALL(*primary, create("env1")).Times(1).WillOnce(Return(env1));
+    EXPECT_CALL(*dependency, create("env1")).Times(1).WillOnce(Return(env1));
+    EXPECT_CALL(*primary, create("env2")).Times(1).WillOnce(Return(nullptr));
+    EXPECT_CALL(*primary, create("env3")).Times(0);
+    EXPECT_CALL(*dependency, create("env3")).Times(0);
+
+    auto ptxn = boost::make_shared<MockGraphTxn>();
+    auto dtxn = boost::make_shared<MockGraphTxn>();
+    EXPECT_CALL(*ptxn, abort()).Times(1);                                       // env1 is undone too
+    EXPECT_CALL(*dtxn, abort()).Times(1);
+    EXPECT_CALL(*primary, start_txn())
+        .Times(1)
+        .WillOnce(Return(ptxn));
+    EXPECT_CALL(*dependency, start_txn())
+        .Times(1)
+        .WillOnce(Return(dtxn));
+
+    ::range::RangeAPI_v1 api { cfg };
+
+    std::vector<range::RangeAPI_v1::Mutation> batch {
+        { "create_env", { "env1" } },
+        { "create_env", { "env2" } },
+        { "create_env", { "env3" } },
+    };
+    EXPECT_THROW(api.apply_batch(batch), range::CreateNodeException);
+}
+
+
 //##############################################################################
 //##############################################################################
 
@@ -32,6 +32,7 @@ static ::range::EmitterModuleRegistration LearnerLogModule { "stored.paxos.Learn
 Learner::Learner(boost::shared_ptr<::range::StoreDaemonConfig> cfg)
     : QueueWorkerThread(LearnerLogModule), cfg_(cfg), range_(cfg_)
 {
+    range_.refresh_head_snapshot();
 }
 
 //##############################################################################
@@ -140,12 +141,15 @@ void Learner::learn(stored::Request req)
     BOOST_LOG_FUNCTION()
     LOG(debug0, "learning") << req.proposal_num();
 
-    bool success;
+    bool success = false;
+    bool invalid = false;
     uint32_t code = 0;
     std::string reason;
     auto it = ::range::RangeAPI_v1::write_api_symtable.find(req.method());
     typedef range::RangeAPI_v1::ErrorCode ec;
 
+    auto backend = cfg_->db_backend();
+    backend->begin_write_batch();                                               // one log flush for the whole request
     if(it != ::range::RangeAPI_v1::write_api_symtable.end()) {
         std::vector<std::string> args;
         for(int x = 0; x < req.args_size(); ++x) {
@@ -156,7 +160,7 @@ void Learner::learn(stored::Request req)
         }
         catch (range::IncorrectNumberOfArguments &e) {
             LOG(error, "invalid_number_of_arguments") << e.what();
-            return;
+            invalid = true;
         }
         catch(range::Exception &e) {
             LOG(info, "txn_failed") << e.what();
@@ -187,8 +191,25 @@ void Learner::learn(stored::Request req)
                 code = static_cast<uint32_t>(ec::UNKNOWN);
             }
         }
+        catch(...) {
+            backend->end_write_batch();                                         // don't leave this thread batching
+            throw;
+        }
+    }
+
+    try {
+        backend->end_write_batch();                                             // graph commits aren't undone by a failure; make them durable
+    }
+    catch(range::Exception &e) {
+        LOG(error, "write_batch_flush_failure") << e.what();
+        success = false;
+        reason = e.what();
+        code = static_cast<uint32_t>(ec::UNKNOWN);
     }
-    
+    if(invalid) {
+        return;
+    }
+
     if(req.client_id().substr(0,cfg_->node_id().size() + 1) == cfg_->node_id() + "|") {
         ::range::stored::Ack ack;
         ack.set_reason(reason);
@@ -199,6 +220,10 @@ void Learner::learn(stored::Request req)
         ::range::stored::RequestQueueListener reqql { request_queue_, cfg_ };
         reqql.send_ack(req.client_id(), ack);
     }
+
+    if(success) {
+        range_.refresh_head_snapshot();                                         // after the ack; the client needn't wait
+    }
 }
 
 
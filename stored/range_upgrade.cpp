@@ -0,0 +1,211 @@
+/*
+ * This file is part of range++.
+ *
+ * range++ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * range++ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with range++.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <getopt.h>
+#include <cstdlib>
+#include <set>
+#include <string>
+#include <vector>
+#include <iostream>
+
+#include <rangexx/core/log.h>
+#include <rangexx/core/config.h>
+#include <rangexx/core/config_builder.h>
+#include <rangexx/db/berkeley_dbcxx_backend.h>
+#include <rangexx/db/head_node.h>
+#include <rangexx/db/node_info_cache.h>
+#include <rangexx/db/node_type_index.h>
+#include <rangexx/db/node_tag_index.h>
+
+#ifndef DEFAULT_CONFIG_PATH
+#define DEFAULT_CONFIG_PATH "/etc/range/range.conf"
+#endif
+
+//##############################################################################
+//##############################################################################
+void
+print_help(const char * progname)
+{
+    std::cout << progname << ":" << std::endl
+        << "Rewrite range++ node records in the current on-disk format (format_version "
+        << range::db::HeadNode::format_version << "), with their history split out of the" << std::endl
+        << "current record, and rebuild the node type and tag indexes." << std::endl
+        << "Stop stored before running this." << std::endl
+        << std::endl
+        << "-c FILE, --config=FILE" << std::endl
+        << "\tSpecify the configuration file for the range++ storage daemon" << std::endl
+        << std::endl
+        << "-a, --convert-access-method" << std::endl
+        << "\tFirst copy each graph into the layout set by graph_access_method in" << std::endl
+        << "\tthe configuration file, if it was created with the other one" << std::endl
+        << std::endl
+        << "-e ENCODING, --node-encoding=ENCODING" << std::endl
+        << "\tAlso convert node records to ENCODING, and keep writing them in it:" << std::endl
+        << "\t`protobuf' (one NodeInfo message) or `sectioned' (tags and edges each" << std::endl
+        << "\tdecoded only when read)" << std::endl
+        << std::endl
+        << "-g GRAPH, --graph=GRAPH" << std::endl
+        << "\tOnly upgrade GRAPH; may be given more than once (default: every graph)" << std::endl
+        << std::endl
+        << "-v, --verbose" << std::endl
+        << "\tSpecify repeatedly to increase verbosity" << std::endl
+        << std::endl
+        << "-h, --help" << std::endl
+        << "\tprint this help message and exit" << std::endl
+        << std::endl;
+}
+
+const struct option longopts[] = {
+    { "config",     required_argument,      NULL,     'c' },
+    { "convert-access-method", no_argument, NULL,     'a' },
+    { "node-encoding", required_argument,   NULL,     'e' },
+    { "graph",      required_argument,      NULL,     'g' },
+    { "verbose",    no_argument,            NULL,     'v' },
+    { "help",       no_argument,            NULL,     'h' },
+    { 0, 0, 0 ,0 }
+};
+
+const char optstring[] = "ac:e:g:vh";
+
+//##############################################################################
+// Format upgrades don't change what's in the graph, so they are flushed
+// without recording a new graph version; which is also what cached nodes are
+// checked against, so the cache is emptied once they are rewritten (stored,
+// the only other reader, is stopped).
+//##############################################################################
+static size_t
+upgrade_graph(boost::shared_ptr<range::db::GraphInstanceInterface> inst, const std::string &encoding)
+{
+    typedef range::db::GraphInstanceInterface::record_type record_type;
+
+    std::vector<std::string> names;                                             // the cursor doesn't survive writes
+    auto cur = inst->get_cursor();
+    for (auto n = cur->first(); n; n = cur->next()) {
+        names.push_back(n->name());
+    }
+    cur.reset();
+
+    size_t upgraded = 0;
+    auto lock = inst->write_lock(record_type::UNKNOWN, "");
+    auto txn = inst->start_txn();
+    uint64_t head = inst->version();
+    if (!encoding.empty()) {                                                    // upgrade_format() rewrites nodes in any other
+        inst->write_record(record_type::GRAPH_META, "node_encoding", 0, encoding);
+    }
+    range::db::NodeTypeIndex index { inst };
+    range::db::NodeTagIndex tag_index { inst };
+    index.clear();
+    tag_index.clear();
+    for (auto &name : names) {
+        range::db::HeadNode node { name, inst };
+        if (node.upgrade_format(head)) {
+            ++upgraded;
+        }
+        node.add_to_type_index(index);
+        node.add_to_tag_index(tag_index, head);
+    }
+    index.flush();
+    index.set_complete_from(0);
+    tag_index.flush();
+    tag_index.set_complete_from(head);                                          // older versions' tags can't be recovered
+    inst->write_record(record_type::GRAPH_META, "live_intervals", 0,            // every live node now stays live on its own
+            std::to_string(static_cast<unsigned long long>(head)));
+    txn->flush();
+    txn->abort();
+    range::db::NodeInfoCache::get()->clear();
+    return upgraded;
+}
+
+static ::range::EmitterModuleRegistration mainLogModule { "main" };
+//##############################################################################
+//##############################################################################
+int
+main(int argc, char ** argv)
+{
+    int lidx;
+    int ret = 0;
+    std::string cfgfile;
+    std::string encoding;
+    std::set<std::string> graphs;
+    bool convert = false;
+    int verbosity = 2;
+
+    char c = 0;
+    while ( (c = getopt_long(argc, argv, optstring, longopts, &lidx)) > 0 ) {
+        switch(c) {
+            case '?':
+                ret = 1;
+            case 'h':
+                print_help(argv[0]);
+                return(ret);
+            case 'a':
+                convert = true;
+                break;
+            case 'c':
+                cfgfile = optarg;
+                break;
+            case 'e':
+                encoding = optarg;
+                if (encoding != "protobuf" && encoding != "sectioned") {
+                    std::cerr << "unknown node encoding: " << encoding << std::endl;
+                    print_help(argv[0]);
+                    return(1);
+                }
+                break;
+            case 'g':
+                graphs.insert(optarg);
+                break;
+            case 'v':
+                ++verbosity;
+                break;
+            default:
+                break;
+        }
+    }
+
+    if (cfgfile.empty()) {
+        cfgfile = DEFAULT_CONFIG_PATH;
+    }
+
+    if (verbosity > static_cast<uint8_t>(::range::Emitter::logseverity::debug9)) {
+        verbosity = static_cast<uint8_t>(::range::Emitter::logseverity::debug9);
+    }
+
+    ::range::initialize_logger("/dev/stdout", static_cast<uint8_t>(::range::Emitter::logseverity(verbosity)), "");
+    ::range::Emitter log { mainLogModule };
+    BOOST_LOG_FUNCTION();
+
+    {
+        auto cfg = ::range::config_builder(cfgfile, ::range::Consumer::STORED);
+        auto backend = cfg->db_backend();
+        for (auto &gname : backend->listGraphInstances()) {
+            if (!graphs.empty() && graphs.count(gname) == 0) {
+                continue;
+            }
+            if (convert) {
+                auto bdb = boost::dynamic_pointer_cast<range::db::BerkeleyDB>(backend);
+                if (bdb && bdb->convert_graph(gname)) {
+                    std::cout << gname << ": converted to the configured access method" << std::endl;
+                }
+            }
+            size_t upgraded = upgrade_graph(backend->getGraphInstance(gname), encoding);
+            std::cout << gname << ": upgraded " << upgraded << " nodes" << std::endl;
+        }
+        backend->shutdown(true);
+    }
+    return 0;
+}